@@ -0,0 +1,255 @@
+/*
+ * bench_3d.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Headless cycle benchmark for the 3d library, run under z88dk-ticks.
+ *
+ * One operation is selected per build with -DBENCH_<OP>, and is run
+ * BENCH_COUNT times between the TIMER_START and TIMER_STOP labels.
+ * The bench_3d.sh script looks the labels up in the map file, and
+ * reports the z88dk-ticks cycle count divided by BENCH_COUNT.
+ *
+ * BENCH_GLXGEARS runs BENCH_COUNT frames of the demo glxgears pipeline,
+ * transforming, culling and clipping the three gear meshes, with the
+ * screen lines written to a sink in place of the ReGIS output.
+ *
+ * zcc +z80 -vn -startup=0 -clib=new -O2 --opt-code-speed=all --math32 -m -DBENCH_MULT_VA bench_3d.c @build/3d.lst -o build/bench -create-app
+ * z88dk-ticks -counter 999999999 -start <TIMER_START> -end <TIMER_STOP> build/bench.bin
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include <intrinsic.h>
+
+#if __SCCZ80
+#include "../source/include/sccz80/3d.h"
+#elif __SDCC
+#include "../source/include/sdcc/3d.h"
+#endif
+
+#ifndef BENCH_COUNT
+#define BENCH_COUNT 64
+#endif
+
+vector_t vertex_in[BENCH_COUNT];
+vector_t vertex_out[BENCH_COUNT];
+
+matrix_t transform;
+matrix_t model;
+matrix_t product;
+
+#if BENCH_GLXGEARS
+
+// the demo view, with the frames drawn into a 480 x 480 window
+#define W 480
+#define H 480
+#define NEAR 1.0
+#define FAR 100.0
+#define FOV 55.0 // degrees
+
+// binary angle from degrees, 0x4000 is a right angle
+#define DEG_BAM(d) ((int16_t)((d) * 65536.0 / 360))
+
+#include "../demo/models_packed.h"
+
+#define MESH_VERTICES 400       // unique vertices of the three glxgears
+#define MESH_CACHE 200          // unique vertices of the largest gear, glxgear1
+
+vector_t mesh_vertices[MESH_VERTICES];
+
+mesh_t mesh[3];
+
+vertex_t vertex_cache[MESH_CACHE];
+
+matrix_t projection_matrix;
+viewport_t viewport;
+
+volatile int16_t sink;          // the screen lines, so none of the frame is optimised away
+
+
+// transform, cull and clip a mesh, and write its screen lines to the sink
+void frame_mesh(const mesh_t * mesh, matrix_t * transform)
+{
+    vertex_t * last = vertex_cache;
+
+    if(cull_sphere(&mesh->centre, mesh->radius, transform)) return;
+
+    mesh_transform(vertex_cache, mesh, transform, &viewport);
+
+    for(uint16_t i = 0; i < mesh->index_count; ++i)
+    {
+        uint16_t index = mesh->indices[i];
+        vertex_t * vertex = &vertex_cache[index & ~MESH_MOVE];
+
+        if(!(index & MESH_MOVE))
+        {
+            int16_t line[4];
+
+            if(clip_vertex_line(last, vertex, &viewport, line))
+            {
+                sink = line[0] + line[1] + line[2] + line[3];
+            }
+        }
+
+        last = vertex;
+    }
+}
+
+
+// one frame of the demo glxgears_loop()
+void frame_glxgears(void)
+{
+    static uint16_t rotz = 0;
+    static int16_t roty = DEG_BAM(30.0);
+
+    matrix_t view_transform;
+    matrix_t mvp;
+
+    identity_m(&view_transform);
+    translate_m(&view_transform, 0, FLOAT_C(1.0), FLOAT_C(-20.0));
+
+    identity_m(&model);
+    rotz_bam_m(&model, rotz);
+    translate_m(&model, FLOAT_C(-1.0), FLOAT_C(2.0), 0);
+    roty_bam_m(&model, roty);
+    mult_am(&model, &view_transform);
+    mult_m_into(&mvp, &model, &projection_matrix);
+    frame_mesh(&mesh[0], &mvp);
+
+    identity_m(&model);
+    rotz_bam_m(&model, DEG_BAM(9.0) - (rotz << 1));
+    translate_m(&model, FLOAT_C(5.2), FLOAT_C(2.0), 0);
+    roty_bam_m(&model, roty);
+    mult_am(&model, &view_transform);
+    mult_m_into(&mvp, &model, &projection_matrix);
+    frame_mesh(&mesh[1], &mvp);
+
+    identity_m(&model);
+    rotz_bam_m(&model, DEG_BAM(30.0) - (rotz << 1));
+    translate_m(&model, FLOAT_C(-1.1), FLOAT_C(-4.2), 0);
+    roty_bam_m(&model, roty);
+    mult_am(&model, &view_transform);
+    mult_m_into(&mvp, &model, &projection_matrix);
+    frame_mesh(&mesh[2], &mvp);
+
+    rotz += DEG_BAM(2.0);
+    roty -= DEG_BAM(1.0);
+}
+#endif
+
+
+int main(void)
+{
+    identity_m(&transform);
+    rotz_m(&transform, FLOAT_C(0.5));
+    roty_m(&transform, FLOAT_C(0.25));
+    translate_m(&transform, 0, FLOAT_C(1.0), FLOAT_C(20.0));
+
+    for(uint16_t i = 0; i < BENCH_COUNT; ++i)
+    {
+        vertex_in[i].x = MUL(ITOF(i), FLOAT_C(0.125));
+        vertex_in[i].y = MUL(ITOF(i), FLOAT_C(-0.25));
+        vertex_in[i].z = FLOAT_C(1.0) - MUL(ITOF(i), FLOAT_C(0.0625));
+        vertex_in[i].w = FLOAT_C(1.0);
+        vertex_out[i] = vertex_in[i];
+    }
+
+#if BENCH_MULT_M
+    identity_m(&model);         // a full matrix, as zero operands are short circuited by the float libraries
+    rotx_m(&model, FLOAT_C(0.5));
+    roty_m(&model, FLOAT_C(0.25));
+    rotz_m(&model, FLOAT_C(0.125));
+    translate_m(&model, FLOAT_C(1.0), FLOAT_C(-2.0), FLOAT_C(3.0));
+#endif
+
+#if BENCH_GLXGEARS
+    viewport_init(&viewport, 0, 0, W, H);
+    projection_w3woody_m(&projection_matrix, FLOAT_C(FOV * (M_PI / 180.0)), DIV(ITOF(W), ITOF(H)), FLOAT_C(NEAR), FLOAT_C(FAR));
+
+    mesh_model(&mesh[0], &mesh_vertices[0], &glxgear1_model);
+    mesh_model(&mesh[1], &mesh_vertices[glxgear1_model.vertex_count], &glxgear2_model);
+    mesh_model(&mesh[2], &mesh_vertices[glxgear1_model.vertex_count + glxgear2_model.vertex_count], &glxgear3_model);
+#endif
+
+    intrinsic_label(TIMER_START);
+
+#if BENCH_MULT_V
+    for(uint16_t i = 0; i < BENCH_COUNT; ++i)
+    {
+        mult_v(&vertex_out[i], &transform);
+    }
+#elif BENCH_MULT_VA
+    mult_va(vertex_out, vertex_in, BENCH_COUNT, &transform);
+#elif BENCH_UNIT_V
+    for(uint16_t i = 0; i < BENCH_COUNT; ++i)
+    {
+        unit_v(&vertex_out[i]);
+    }
+#elif BENCH_DOT_V
+    for(uint16_t i = 0; i < BENCH_COUNT; ++i)
+    {
+        vertex_out[i].w = dot_v(&vertex_in[i], &vertex_out[i]);
+    }
+#elif BENCH_MULT_M
+    for(uint16_t i = 0; i < BENCH_COUNT; ++i)
+    {
+        mult_m_into(&product, &model, &transform);
+    }
+#elif BENCH_ROT_M
+    for(uint16_t i = 0; i < BENCH_COUNT; ++i)
+    {
+        identity_m(&model);
+        rotx_m(&model, FLOAT_C(0.5));
+        roty_m(&model, FLOAT_C(0.25));
+        rotz_m(&model, FLOAT_C(0.125));
+    }
+#elif BENCH_EULER_M
+    for(uint16_t i = 0; i < BENCH_COUNT; ++i)
+    {
+        identity_m(&model);
+        euler_m(&model, FLOAT_C(0.5), FLOAT_C(0.25), FLOAT_C(0.125));
+    }
+#elif BENCH_ROT_BAM_M
+    for(uint16_t i = 0; i < BENCH_COUNT; ++i)
+    {
+        identity_m(&model);
+        rotx_bam_m(&model, 0x1460);
+        roty_bam_m(&model, 0x0a30);
+        rotz_bam_m(&model, 0x0518);
+    }
+#elif BENCH_GLXGEARS
+    for(uint16_t i = 0; i < BENCH_COUNT; ++i)
+    {
+        frame_glxgears();
+    }
+#endif
+
+    intrinsic_label(TIMER_STOP);
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+#!/usr/bin/env bash
+# Cycle benchmark for the 3d library, run headless under z88dk-ticks.
+#
+# Each operation is built as its own +z80 binary from bench_3d.c and the
+# library sources listed in ../source/3d.lst, and z88dk-ticks counts the
+# cycles between the TIMER_START and TIMER_STOP labels.
+#
+# Output is one tab separated line per clib, FLOAT build and operation,
+# with the cycles per operation (vertex, or glxgears frame) in the last
+# column.
+#
+#   ./bench_3d.sh                 run all operations
+#   ./bench_3d.sh MULT_V MULT_VA  run the named operations only
+#   ./bench_3d.sh > base.tsv      save a baseline, then after rebuilding
+#   BENCH_BASELINE=base.tsv ./bench_3d.sh
+#                                 add the baseline cycles and the change,
+#                                 and exit 1 if any operation is slower by
+#                                 more than BENCH_TOLERANCE percent (default 1)
+#                                 (exit 2 if a TIMER label is missing from the map)
+#
+#   BENCH_CLIB="new sdcc_ix sdcc_iy" selects the compilers, sccz80 (new) or zsdcc.
+#
+#   BENCH_MATH="math32 math16 fixed am9511 am9511-apu" selects the FLOAT
+#   builds to measure, where am9511 uses the library float calls and
+#   am9511-apu the opt in APU kernels (both need a z88dk-ticks with
+#   Am9511 APU emulation, and the APU kernels need __IO_APU_DATA and __IO_APU_CONTROL
+#   from the target). The math16 build is sccz80 only, as for the 3df16 library.
+#
+#   BENCH_COUNT sets the repeats of each operation (default 64), and BENCH_FRAMES
+#   the glxgears frames (default 4).
+set -euo pipefail
+
+cd "$(dirname "$0")"
+
+COUNT=${BENCH_COUNT:-64}
+FRAMES=${BENCH_FRAMES:-4}
+CLIBS=(${BENCH_CLIB:-new sdcc_ix sdcc_iy})
+MATHS=(${BENCH_MATH:-math32 math16 fixed})
+BASELINE=${BENCH_BASELINE:-}
+TOLERANCE=${BENCH_TOLERANCE:-1}
+OPS=("$@")
+if (( ${#OPS[@]} == 0 )); then
+  OPS=(MULT_V MULT_VA UNIT_V DOT_V MULT_M ROT_M ROT_BAM_M EULER_M GLXGEARS)
+fi
+
+mkdir -p build
+sed -n 's|^\./|../source/|p' ../source/3d.lst >build/3d.lst
+
+# look up a label address in the map file, with or without a leading underscore
+label() {
+  local addr
+  addr=$(sed -n "s/^_*$1[[:space:]]*= \$\([0-9A-Fa-f]*\).*/0x\1/p" build/bench.map | head -1)
+  if [[ -z $addr ]]; then
+    echo "bench_3d.sh: $1 not found in build/bench.map" >&2
+    exit 2
+  fi
+  echo "$addr"
+}
+
+# cycles per operation of the matching clib, math and op line in the baseline
+baseline() {
+  awk -F '\t' -v c="$1" -v m="$2" -v o="$3" '$1 == c && $2 == m && $3 == o { print $6 }' "$BASELINE" | head -1
+}
+
+if [[ -n $BASELINE ]]; then
+  printf 'clib\tmath\top\tcount\tcycles\tcycles_per_op\tbaseline_per_op\tchange_percent\n'
+else
+  printf 'clib\tmath\top\tcount\tcycles\tcycles_per_op\n'
+fi
+
+slower=0
+for clib in "${CLIBS[@]}"; do
+  case "$clib" in
+    new) cflag=(-clib=new -O2 --opt-code-speed=all) ;;
+    *)   cflag=(-clib="$clib" -SO3 --max-allocs-per-node400000) ;;
+  esac
+  for math in "${MATHS[@]}"; do
+    case "$math" in
+      fixed)          mflag=(-D__MATH_FIXED) ;;
+      am9511-apu)     mflag=(--am9511 -D__3D_APU) ;;
+      *)              mflag=(--"$math") ;;
+    esac
+    [[ $math == math16 && $clib != new ]] && continue
+    for op in "${OPS[@]}"; do
+      count=$COUNT
+      [[ $op == GLXGEARS ]] && count=$FRAMES
+      zcc +z80 -vn -startup=0 "${cflag[@]}" "${mflag[@]}" -m \
+        -DBENCH_"$op" -DBENCH_COUNT="$count" bench_3d.c @build/3d.lst -o build/bench -create-app
+      start=$(label TIMER_START)
+      stop=$(label TIMER_STOP)
+      cycles=$(z88dk-ticks -counter 999999999 -start "$start" -end "$stop" build/bench.bin | grep -Eo '[0-9]+' | tail -1)
+      per_op=$(( cycles / count ))
+      if [[ -n $BASELINE ]]; then
+        base=$(baseline "$clib" "$math" "$op")
+        if [[ -n $base && $base -gt 0 ]]; then
+          change=$(awk -v n="$per_op" -v b="$base" 'BEGIN { printf "%+.1f", (n - b) * 100 / b }')
+          awk -v c="$change" -v t="$TOLERANCE" 'BEGIN { exit !(c > t) }' && slower=1
+        else
+          base=-; change=-
+        fi
+        printf '%s\t%s\t%s\t%d\t%d\t%d\t%s\t%s\n' "$clib" "$math" "$op" "$count" "$cycles" "$per_op" "$base" "$change"
+      else
+        printf '%s\t%s\t%s\t%d\t%d\t%d\n' "$clib" "$math" "$op" "$count" "$cycles" "$per_op"
+      fi
+    done
+  done
+done
+
+exit $slower
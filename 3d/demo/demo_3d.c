@@ -39,18 +39,21 @@
  */
 
 // ZSDCC compile
-// zcc +cpm -clib=sdcc_iy -v -m --list -SO3 --max-allocs-per-node100000 -llib/cpm/regis -llib/cpm/3d --math32 demo_3d.c -o 3d -create-app
-// zcc +cpm -clib=sdcc_iy -v -m --list -SO3 --max-allocs-per-node100000 -llib/cpm/regis -llib/cpm/3d --am9511 demo_3d.c -o 3dapu -create-app
+// zcc +cpm -clib=sdcc_iy -v -m --list -SO3 --max-allocs-per-node100000 -l../../regis/regis -l../3d --math32 demo_3d.c -o 3d -create-app
+// zcc +cpm -clib=sdcc_iy -v -m --list -SO3 --max-allocs-per-node100000 -l../../regis/regis -l../3d --am9511 demo_3d.c -o 3dapu -create-app
 
 // SCCZ80 compile
-// zcc +cpm -clib=new -v -m --list -O2 --opt-code-speed=all -llib/cpm/regis -llib/cpm/3d --math32 demo_3d.c -o 3d -create-app
-// zcc +cpm -clib=new -v -m --list -O2 --opt-code-speed=all -llib/cpm/regis -llib/cpm/3d --am9511 demo_3d.c -o 3dapu -create-app
+// zcc +cpm -clib=new -v -m --list -O2 --opt-code-speed=all -l../../regis/regis -l../3d --math32 demo_3d.c -o 3d -create-app
+// zcc +cpm -clib=new -v -m --list -O2 --opt-code-speed=all -l../../regis/regis -l../3d --am9511 demo_3d.c -o 3dapu -create-app
 
 // SCCZ80 compile with math16 (16-bit floating point)
-// zcc +cpm -clib=new -v -m --list -O2 --opt-code-speed=all -llib/cpm/regis -llib/cpm/3df16 --math16 demo_3d.c -o 3df16 -create-app
+// zcc +cpm -clib=new -v -m --list -O2 --opt-code-speed=all -l../../regis/regis -l../3df16 --math16 demo_3d.c -o 3df16 -create-app
+
+// SCCZ80 compile with Q16.16 fixed point
+// zcc +cpm -clib=new -v -m --list -O2 --opt-code-speed=all -l../../regis/regis -l../3dfix -D__MATH_FIXED demo_3d.c -o 3dfix -create-app
 
 // SCCZ80 compile for 8085 with Am9511 APU (32-bit floating piont)
-// zcc +cpm -clib=8085 -v -m --list -O2 --opt-code-speed=all -DAMALLOC -l../../libsrc/_DEVELOPMENT/lib/sccz80/lib/cpm/regis_8085 -l../../libsrc/_DEVELOPMENT/lib/sccz80/lib/cpm/3d_8085 --math-am9511 demo_3d.c -o 3d-8085 -create-app
+// zcc +cpm -clib=8085 -v -m --list -O2 --opt-code-speed=all -DAMALLOC -l../../regis/regis_8085 -l../3d_8085 --math-am9511 demo_3d.c -o 3d-8085 -create-app
 
 // display using XTerm & picocom
 // xterm +u8 -geometry 132x50 -ti 340 -tn 340 -e picocom -b 115200 -p 2 -f h /dev/ttyUSB0 --send-cmd "sx -vv"
@@ -65,20 +68,17 @@
 
 #if __8085
 #pragma output noprotectmsdos
-#pragma printf = "%s %c %0d"                        // for classic enables %s, %c, %0d only
+#pragma printf = "%c %u %lu"                        // for classic enables %c, %u, %lu only
 #pragma scanf  = "%s %c"                            // for classic enables %s, %c only
-#define  in_test_key()  getk()
-#include <_DEVELOPMENT/sccz80/lib/cpm/regis.h>      // REGIS library
-#include <_DEVELOPMENT/sccz80/lib/cpm/3d.h>         // 3D library
-#elif __CPM
-#include <lib/cpm/regis.h>      // REGIS library
-#include <lib/cpm/3d.h>         // 3D library
-#elif __RC2014
-#include <lib/rc2014/regis.h>   // REGIS library
-#include <lib/rc2014/3d.h>      // 3D library
-#elif __YAZ180
-#include <lib/yaz180/regis.h>   // REGIS library
-#include <lib/yaz180/3d.h>      // 3D library
+#define  in_inkey()     getk()
+#endif
+
+#if __SCCZ80                    // REGIS and 3D libraries, headers matching the libraries built from source
+#include "../../regis/source/include/sccz80/regis.h"
+#include "../source/include/sccz80/3d.h"
+#elif __SDCC
+#include "../../regis/source/include/sdcc/regis.h"
+#include "../source/include/sdcc/3d.h"
 #endif
 
 #ifndef __CPM
@@ -89,11 +89,11 @@
 
 #define W 480
 #define H 480
-#define NEAR -100.0
+#define NEAR 1.0
 #define FAR 100.0
-#define FOV 3.0 // degrees
+#define FOV 55.0 // degrees
 
-#include "models.h"
+#include "models_packed.h"
 
 // these are the demonstration options
 #define CUBE '1'
@@ -101,174 +101,414 @@
 #define GEAR '3'
 #define GLXGEARS '4'
 
+// binary angle from degrees, 0x4000 is a right angle
+#define DEG_BAM(d) ((int16_t)((d) * 65536.0 / 360))
+
 uint8_t animate = 1;
 
-FLOAT user_rotx = 0;
-FLOAT user_roty = 0;
+uint8_t backface = 0;           // cull back faces, selected with a second 'b' argument
 
-FLOAT half_width;
-FLOAT half_height;
+uint8_t delta = 0;              // redraw only the changed lines, selected with a second 'd' argument
+
+uint16_t frames = 0;            // count frames, to compare the FLOAT backends
+
+uint16_t user_rotx = 0;          // binary angles, 0x10000 to a full turn
+uint16_t user_roty = 0;
 
 // create the matrix which transforms from 3D to 2D
 matrix_t projection_matrix;
 
+// map the clipped 2D coordinates onto the screen, with y down
+viewport_t viewport;
+
 // set up the display window for REGIS library
 window_t my_window;
 
+// collect the ReGIS output of each frame, written in chunks of this size
+#define REGIS_BUFFER 512
+
+char regis_buffer[REGIS_BUFFER];
+
+// collect the connected lines of a polyline, to draw them with one vector command
+#define REGIS_RUN 32
+
+uint16_t regis_run[2 * REGIS_RUN];
+uint16_t regis_run_count = 0;
+
+// indexed meshes for the selected demonstration, built from the models
+#define MESH_VERTICES 400       // unique vertices of the largest demonstration, glxgears
+#define MESH_POLYLINES 230      // polylines of the largest demonstration, glxgears
+#define MESH_CACHE 200          // unique vertices of the largest model, glxgear1
+
+vector_t mesh_vertices[MESH_VERTICES];
+uint16_t mesh_vertices_used = 0;
+
+vector_t mesh_planes[MESH_POLYLINES];
+uint16_t mesh_planes_used = 0;
+
+mesh_t mesh[3];
+
+// transformed vertices of the mesh being drawn
+vertex_t vertex_cache[MESH_CACHE];
+
+// screen lines of each mesh, this frame and the last, for the delta mode
+#define LINES_GEAR1 310         // lines of glxgear1, the largest model
+#define LINES_GEAR2 160         // lines of glxgear2 and glxgear3
+#define TABLE_GEAR1 1024        // hash table entries of each mesh, kept from erase to draw
+#define TABLE_GEAR2 512
+
+int16_t lines_gear1[8 * LINES_GEAR1];
+int16_t lines_gear2[8 * LINES_GEAR2];
+int16_t lines_gear3[8 * LINES_GEAR2];
+uint16_t table_gear1[TABLE_GEAR1];
+uint16_t table_gear2[TABLE_GEAR2];
+uint16_t table_gear3[TABLE_GEAR2];
+
+lines_t mesh_lines[3];
+w_intensity_t mesh_intensity[3];
+
+uint8_t delta_clear = 0;        // a line list was full, so clear the screen for the next frame
+
 
 void begin_projection()
 {
-    half_width = (FLOAT)WIDTH_MAX * 0.5;
-    half_height = (FLOAT)HEIGHT_MAX * 0.5;
-//  projection_opengl_m(&projection_matrix, FOV * (M_PI / 180.0), (FLOAT)W/(FLOAT)H, NEAR, FAR); // or
-    projection_w3woody_m(&projection_matrix, FOV * (M_PI / 180.0), (FLOAT)W/(FLOAT)H, NEAR, FAR);
+    viewport_init(&viewport, (WIDTH_MAX - W)/2, (HEIGHT_MAX - H)/2, W, H);
+//  projection_opengl_m(&projection_matrix, FLOAT_C(FOV * (M_PI / 180.0)), DIV(ITOF(W), ITOF(H)), FLOAT_C(NEAR), FLOAT_C(FAR)); // or
+    projection_w3woody_m(&projection_matrix, FLOAT_C(FOV * (M_PI / 180.0)), DIV(ITOF(W), ITOF(H)), FLOAT_C(NEAR), FLOAT_C(FAR));
 }
 
 
-void read_point(point_t * point, unsigned char ** ptr)
+// expand a packed model into an indexed mesh, with the polyline planes for back face culling
+void mesh_new(mesh_t * mesh, const model_t * model)
 {
-    memcpy((uint8_t *)point, *ptr, sizeof(point_t));
-    (*ptr) += sizeof(point_t);
+    uint16_t count = model->index_count;
+
+    mesh_model(mesh, &mesh_vertices[mesh_vertices_used], model);
+    mesh_vertices_used += mesh->vertex_count;
+
+    // closed polylines are faces, with a plane facing away from the centre
+    mesh->planes = &mesh_planes[mesh_planes_used];
+
+    for(uint16_t i = 0; i < count; )
+    {
+        vector_t * plane = &mesh_planes[mesh_planes_used++];
+        uint16_t start = i;
+
+        while(++i < count && !(mesh->indices[i] & MESH_MOVE));
+
+        plane->x = plane->y = plane->z = plane->w = 0;
+
+        if(i - start > 3 && (mesh->indices[start] & ~MESH_MOVE) == mesh->indices[i-1])
+        {
+            vector_t * a = &mesh->vertices[mesh->indices[start] & ~MESH_MOVE];
+            vector_t ab, ac, out;
+
+            ab = mesh->vertices[mesh->indices[start+1]];
+            ac = mesh->vertices[mesh->indices[start+2]];
+            ab.x -= a->x; ab.y -= a->y; ab.z -= a->z;
+            ac.x -= a->x; ac.y -= a->y; ac.z -= a->z;
+            out.x = a->x - mesh->centre.x;
+            out.y = a->y - mesh->centre.y;
+            out.z = a->z - mesh->centre.z;
+
+            cross_v(plane, &ab, &ac);
+            if(dot_v(plane, &out) < 0)
+            {
+                plane->x = -plane->x;
+                plane->y = -plane->y;
+                plane->z = -plane->z;
+            }
+            plane->w = -dot_v(plane, a);
+        }
+    }
 }
 
 
-// draw the model
-void regis_plot(const point_t *model, uint16_t count, matrix_t * transform, w_intensity_t intensity, uint8_t do_init)
+// draw the connected lines collected so far
+void regis_run_flush(void)
 {
-    if(do_init)
+    if(regis_run_count)
     {
-        window_new(&my_window, H, W, stdout);
-        window_clear(&my_window);
+        draw_polyline_abs(&my_window, regis_run, regis_run_count);
+        regis_run_count = 0;
     }
+}
 
-    draw_intensity(&my_window, intensity);
 
-    unsigned char *ptr = (unsigned char*)model;
+// the line callbacks for the delta mode
+void regis_line(int16_t const * line)
+{
+    draw_abs(&my_window, (uint16_t)line[0], (uint16_t)line[1]);
+    draw_line_abs(&my_window, (uint16_t)line[2], (uint16_t)line[3]);
+}
 
-    for(uint16_t i = 0; i < count; ++i)
-    {
-        point_t point;
-        vector_t vertex;
 
-        read_point(&point, &ptr);
+void regis_unline(int16_t const * line)
+{
+    draw_abs(&my_window, (uint16_t)line[0], (uint16_t)line[1]);
+    draw_unline_abs(&my_window, (uint16_t)line[2], (uint16_t)line[3]);
+}
 
-        vertex.x = point.x;
-        vertex.y = point.y;
-        vertex.z = point.z;
-        vertex.w = 1.0;
 
-        mult_v(&vertex,transform);
+// draw the mesh lines
+void regis_mesh(const mesh_t *mesh, lines_t * lines, matrix_t const * modelview, matrix_t const * transform)
+{
+    mesh_transform(vertex_cache, mesh, transform, &viewport);
 
-        scale_v(&vertex, 1.0/(vertex.w));
+    vector_t eye;
+    if(backface)
+    {
+        eye_m(&eye, modelview);
+    }
 
-/* TODO: Clipping here */
+    vertex_t * last = vertex_cache;
+    vector_t * plane = mesh->planes;
+    uint8_t pen = 0;            // pen is already at the start of the next line
+    uint8_t hidden = 0;         // polyline is a back face
 
-        vertex.x = (vertex.x * (FLOAT)W) / (vertex.w * 2.0) + half_width;
-        vertex.y = (vertex.y * (FLOAT)H) / (vertex.w * 2.0) + half_height;
+    for(uint16_t i = 0; i < mesh->index_count; ++i)
+    {
+        uint16_t index = mesh->indices[i];
+        vertex_t * vertex = &vertex_cache[index & ~MESH_MOVE];
 
-        if(point.begin_poly)
+        if(index & MESH_MOVE)
         {
-            draw_abs(&my_window, (uint16_t)vertex.x, (uint16_t)vertex.y);
+            pen = 0;
+            hidden = backface && (dot_v(plane, &eye) + plane->w < 0);
+            ++plane;
         }
-        else
+        else if(!hidden)
         {
-            draw_line_abs(&my_window, (uint16_t)vertex.x, (uint16_t)vertex.y);
+            int16_t line[4];
+            uint8_t clipped = clip_vertex_line(last, vertex, &viewport, line);
+
+            if(clipped && delta)
+            {
+                if(!add_lines(lines, line))
+                {
+                    regis_line(line);   // the list is full, so draw the line now and start again
+                    delta_clear = 1;
+                }
+            }
+            else if(clipped)
+            {
+                if(!pen || (clipped & CLIP_START))
+                {
+                    regis_run_flush();
+                    draw_abs(&my_window, (uint16_t)line[0], (uint16_t)line[1]);
+                }
+                else if(regis_run_count == REGIS_RUN)
+                {
+                    regis_run_flush();  // continue the polyline from where it ends
+                }
+                regis_run[2 * regis_run_count] = (uint16_t)line[2];
+                regis_run[2 * regis_run_count + 1] = (uint16_t)line[3];
+                ++regis_run_count;
+            }
+
+            pen = clipped && !(clipped & CLIP_END);
         }
+
+        last = vertex;
+    }
+
+    regis_run_flush();
+}
+
+
+// set up the line lists of each mesh, with nothing on the screen
+void regis_lines(void)
+{
+    init_lines(&mesh_lines[0], lines_gear1, LINES_GEAR1, table_gear1, TABLE_GEAR1);
+    init_lines(&mesh_lines[1], lines_gear2, LINES_GEAR2, table_gear2, TABLE_GEAR2);
+    init_lines(&mesh_lines[2], lines_gear3, LINES_GEAR2, table_gear3, TABLE_GEAR2);
+    delta_clear = 0;
+}
+
+
+// open the window, only clearing the screen for the first frame in the delta mode, or when a line list was full
+void regis_open(void)
+{
+    window_new(&my_window, H, W, stdout);
+    window_buffer(&my_window, regis_buffer, REGIS_BUFFER);
+    if(!delta || frames == 0 || delta_clear)
+    {
+        window_clear(&my_window);
+        regis_lines();
+    }
+}
+
+
+// erase the lines of every mesh gone since the last frame, and then draw the new lines,
+// redrawing those kept lines which an erased line may have crossed
+void regis_delta(uint8_t count)
+{
+    int16_t box[4] = { INT16_MAX, INT16_MAX, INT16_MIN, INT16_MIN };
+
+    for(uint8_t k = 0; k < count; ++k)
+    {
+        erase_lines(&mesh_lines[k], regis_unline, box);
+    }
+
+    for(uint8_t k = 0; k < count; ++k)
+    {
+        draw_intensity(&my_window, mesh_intensity[k]);
+        draw_lines(&mesh_lines[k], regis_line, box);
+    }
+}
+
+
+// show the ReGIS output of the last frame, to see whether the link or the CPU limits the frame rate
+void regis_count(void)
+{
+    window_count_t count;
+
+    window_count(&my_window, &count);
+    printf("%c[H%lu bytes/frame P %u V %u W %u elided %u  \n", ASCII_ESC,
+        count.bytes, count.position, count.vector, count.writing, count.elided);
+}
+
+
+// draw the model k, unless it is entirely outside the view volume
+void regis_plot(uint8_t k, matrix_t const * modelview, matrix_t const * transform, w_intensity_t intensity, uint8_t do_init)
+{
+    if(do_init)
+    {
+        regis_open();
+    }
+
+    mesh_intensity[k] = intensity;
+
+    if(!cull_sphere(&mesh[k].centre, mesh[k].radius, transform))
+    {
+        draw_intensity(&my_window, intensity);
+        regis_mesh(&mesh[k], &mesh_lines[k], modelview, transform);
     }
 
     if(do_init)
     {
+        if(delta)
+        {
+            regis_delta(1);
+        }
         window_close(&my_window);
     }
 }
 
 
-void glxgears_loop()
+// the glxgears scene, with the gears below a tilt below the camera view
+node_t camera;
+node_t tilt;
+node_t gear_node[3];
+
+const vector_t x_axis = { FLOAT_C(1.0), 0, 0, FLOAT_C(1.0) };
+const vector_t y_axis = { 0, FLOAT_C(1.0), 0, FLOAT_C(1.0) };
+const vector_t z_axis = { 0, 0, FLOAT_C(1.0), FLOAT_C(1.0) };
+
+static uint16_t glxgears_rotz = 0;
+static int16_t glxgears_roty = DEG_BAM(30.0);
+
+
+// set the rotations which change as the gears turn, and mark the nodes dirty
+void glxgears_turn(void)
 {
-    static FLOAT rotz = 0;
-    static FLOAT roty = 30.0 / 180 * M_PI;
-    static FLOAT step = -1.0 / 180 * M_PI;
+    axis_bam_q(&tilt.rotation, &y_axis, glxgears_roty);
+    axis_bam_q(&gear_node[0].rotation, &z_axis, glxgears_rotz);
+    axis_bam_q(&gear_node[1].rotation, &z_axis, DEG_BAM(9.0) - (glxgears_rotz << 1));
+    axis_bam_q(&gear_node[2].rotation, &z_axis, DEG_BAM(30.0) - (glxgears_rotz << 1));
+
+    tilt.dirty = 1;
+    gear_node[0].dirty = 1;
+    gear_node[1].dirty = 1;
+    gear_node[2].dirty = 1;
+}
 
-    matrix_t view_transform;
-    matrix_t transform;
 
-    window_new(&my_window, H, W, stdout);
-    window_clear(&my_window);
+void glxgears_new(void)
+{
+    quat_t roty;
 
-    identity_m(&view_transform);
-    if(user_rotx != 0) rotx_m(&view_transform, user_rotx);
-    if(user_roty != 0) roty_m(&view_transform, user_roty);
-    translate_m(&view_transform, 0, 1.0, 20.0);      // view transform
+    init_node(&camera, NULL);
+    axis_bam_q(&camera.rotation, &x_axis, user_rotx);
+    axis_bam_q(&roty, &y_axis, user_roty);
+    mult_q(&camera.rotation, &roty);
+    camera.translation.y = FLOAT_C(1.0);
+    camera.translation.z = FLOAT_C(-20.0);      // view transform
 
-    identity_m(&transform);
-    rotz_m(&transform, rotz);
-    translate_m(&transform, -1.0, 2.0, 0);
-    roty_m(&transform, roty);
-//  rotx_m(&transform, 0.0 / 180 * M_PI);
-    mult_m(&transform, &view_transform);
-    mult_m(&transform, &projection_matrix);
+    init_node(&tilt, &camera);
 
-    regis_plot(glxgear1, sizeof(glxgear1) / sizeof(point_t), &transform, _R, 0);
+    init_node(&gear_node[0], &tilt);
+    gear_node[0].translation.x = FLOAT_C(-1.0);
+    gear_node[0].translation.y = FLOAT_C(2.0);
 
-    identity_m(&transform);
-    rotz_m(&transform, -2.0 * rotz + 9.0 / 180 * M_PI);
-    translate_m(&transform, 5.2, 2.0, 0);
-    roty_m(&transform, roty);
-//  rotx_m(&transform, 0.0 / 180 * M_PI);
-    mult_m(&transform, &view_transform);
-    mult_m(&transform, &projection_matrix);
+    init_node(&gear_node[1], &tilt);
+    gear_node[1].translation.x = FLOAT_C(5.2);
+    gear_node[1].translation.y = FLOAT_C(2.0);
 
-    regis_plot(glxgear2, sizeof(glxgear2) / sizeof(point_t), &transform, _G, 0);
+    init_node(&gear_node[2], &tilt);
+    gear_node[2].translation.x = FLOAT_C(-1.1);
+    gear_node[2].translation.y = FLOAT_C(-4.2);
 
-    identity_m(&transform);
-    rotz_m(&transform, -2.0 * rotz + 30.0 / 180 * M_PI);
-    translate_m(&transform, -1.1, -4.2, 0);
-    roty_m(&transform, roty);
-//  rotx_m(&transform, 0.0 / 180 * M_PI);
-    mult_m(&transform, &view_transform);
-    mult_m(&transform, &projection_matrix);
+    glxgears_turn();
+}
+
+
+void glxgears_loop()
+{
+    static int16_t step = DEG_BAM(-1.0);
 
-    regis_plot(glxgear3, sizeof(glxgear3) / sizeof(point_t), &transform, _B, 0);
+    regis_open();
 
+    // only the nodes changed since the last frame are recalculated
+    regis_plot(0, world_node(&gear_node[0]), mvp_node(&gear_node[0], &projection_matrix), _R, 0);
+    regis_plot(1, world_node(&gear_node[1]), mvp_node(&gear_node[1], &projection_matrix), _G, 0);
+    regis_plot(2, world_node(&gear_node[2]), mvp_node(&gear_node[2], &projection_matrix), _B, 0);
+
+    if(delta)
+    {
+        regis_delta(3);
+    }
     window_close(&my_window);
 
     if(animate)
     {
-        rotz += 2.0 / 180 * M_PI;
-        roty += step;
-        if((step > 0 && roty >= 45.0 / 180 * M_PI) ||
-            (step < 0 && roty <= -45.0 / 180 * M_PI))
+        glxgears_rotz += DEG_BAM(2.0);
+        glxgears_roty += step;
+        if((step > 0 && glxgears_roty >= DEG_BAM(45.0)) ||
+            (step < 0 && glxgears_roty <= DEG_BAM(-45.0)))
         {
             step = -step;
         }
+        glxgears_turn();
     }
 }
 
 
 void gear_loop()
 {
-    static FLOAT rotz = 0;
-    static FLOAT roty = 0;
-    static FLOAT step2 = 1.0 / 180 * M_PI;
+    static uint16_t rotz = 0;
+    static int16_t roty = 0;
+    static int16_t step2 = DEG_BAM(1.0);
 
     matrix_t transform;
+    matrix_t mvp;
 
     identity_m(&transform);
-    rotz_m(&transform, rotz);
-    roty_m(&transform, roty);
-    if(user_rotx != 0) rotx_m(&transform, user_rotx);
-    if(user_roty != 0) roty_m(&transform, user_roty);
-    translate_m(&transform, 0, 0, 8.0);
-    mult_m(&transform, &projection_matrix);
+    rotz_bam_m(&transform, rotz);
+    roty_bam_m(&transform, roty);
+    if(user_rotx != 0) rotx_bam_m(&transform, user_rotx);
+    if(user_roty != 0) roty_bam_m(&transform, user_roty);
+    translate_m(&transform, 0, 0, FLOAT_C(-3.2));
+    mult_m_into(&mvp, &transform, &projection_matrix);
 
-    regis_plot(gear, sizeof(gear) / sizeof(point_t), &transform, _W, 1);
+    regis_plot(0, &transform, &mvp, _W, 1);
 
     if(animate)
     {
-        rotz += 2.0 / 360 * M_PI * 2;
+        rotz += DEG_BAM(2.0);
         roty += step2;
-        if((step2 > 0 && roty >= 45.0 / 180 * M_PI) ||
-            (step2 < 0 && roty <= -45.0 / 180 * M_PI))
+        if((step2 > 0 && roty >= DEG_BAM(45.0)) ||
+            (step2 < 0 && roty <= DEG_BAM(-45.0)))
         {
             step2 = -step2;
         }
@@ -278,51 +518,50 @@ void gear_loop()
 
 void icos_loop(void)
 {
-    static FLOAT rotz = 0;
-    static FLOAT roty = 0;
+    static uint16_t rotz = 0;
+    static uint16_t roty = 0;
 
     matrix_t transform;
+    matrix_t mvp;
 
     identity_m(&transform);
-    rotz_m(&transform, rotz);
-    roty_m(&transform, roty);
-    rotx_m(&transform, M_PI/2);
-    if(user_rotx != 0) rotx_m(&transform, user_rotx);
-    if(user_roty != 0) roty_m(&transform, user_roty);
-    translate_m(&transform, 0, 0, 8.0);
-    mult_m(&transform, &projection_matrix);
+    rotz_bam_m(&transform, rotz);
+    roty_bam_m(&transform, roty);
+    rotx_bam_m(&transform, 0x4000);
+    if(user_rotx != 0) rotx_bam_m(&transform, user_rotx);
+    if(user_roty != 0) roty_bam_m(&transform, user_roty);
+    translate_m(&transform, 0, 0, FLOAT_C(-3.2));
+    mult_m_into(&mvp, &transform, &projection_matrix);
 
-    regis_plot(icos, sizeof(icos) / sizeof(point_t), &transform, _W, 1);
+    regis_plot(0, &transform, &mvp, _W, 1);
 
     if(animate)
     {
-        rotz += 0.25 / 360 * M_PI * 2;
-        roty += 2.0 / 360 * M_PI * 2;
+        rotz += DEG_BAM(0.25);
+        roty += DEG_BAM(2.0);
     }
 }
 
 
 void cube_loop(void)
 {
-    static FLOAT rotz = 0;
-    static FLOAT roty = 0;
+    static quat_t orientation = { 0, 0, 0, FLOAT_C(1.0) };
 
     matrix_t transform;
+    matrix_t mvp;
 
     identity_m(&transform);
-    rotz_m(&transform, rotz);
-    roty_m(&transform, roty);
-    if(user_rotx != 0) rotx_m(&transform, user_rotx);
-    if(user_roty != 0) roty_m(&transform, user_roty);
-    translate_m(&transform, 0, 0, 10.0);
-    mult_m(&transform, &projection_matrix);
+    rotq_m(&transform, &orientation);
+    if(user_rotx != 0) rotx_bam_m(&transform, user_rotx);
+    if(user_roty != 0) roty_bam_m(&transform, user_roty);
+    translate_m(&transform, 0, 0, FLOAT_C(-5.0));
+    mult_m_into(&mvp, &transform, &projection_matrix);
 
-    regis_plot(cube, sizeof(cube) / sizeof(point_t), &transform, _W, 1);
+    regis_plot(0, &transform, &mvp, _W, 1);
 
-    if(animate)
+    if(animate)                 // tumble, without any trigonometry
     {
-        rotz += 2.0 / 360 * M_PI * 2;
-        roty += 0.5 / 360 * M_PI * 2;
+        delta_q(&orientation, 0, FLOAT_C(0.5 / 360 * M_PI * 2), FLOAT_C(2.0 / 360 * M_PI * 2));
     }
 }
 
@@ -338,8 +577,32 @@ int main(int argc, char **argv)
         demo = (argv[1])[0];    // get which demo is desired:
     }
 
+    if(argc > 2) {
+        backface = (strchr(argv[2], 'b') != NULL);  // and whether back faces are culled
+        delta = (strchr(argv[2], 'd') != NULL);     // or only the changed lines are redrawn
+    }
+
     begin_projection();
 
+    switch(demo)
+    {
+        case CUBE:
+            mesh_new(&mesh[0], &cube_model);
+            break;
+        case ICOS:
+            mesh_new(&mesh[0], &icos_model);
+            break;
+        case GEAR:
+            mesh_new(&mesh[0], &gear_model);
+            break;
+        case GLXGEARS:
+            mesh_new(&mesh[0], &glxgear1_model);
+            mesh_new(&mesh[1], &glxgear2_model);
+            mesh_new(&mesh[2], &glxgear3_model);
+            glxgears_new();
+            break;
+    }
+
     while(1)
     {
         switch(demo)
@@ -360,8 +623,18 @@ int main(int argc, char **argv)
                 exit(0);
         }
 
-        if( in_test_key() ) break;
+        ++frames;
+
+        uint8_t key = in_inkey();               // read the key once, as getk() consumes it
+
+        if( key )
+        {
+            if( key != 'c' ) break;             // 'c' shows the ReGIS counts, any other key exits
+            regis_count();
+        }
     }
 
+    printf("%c[2J%u frames\n", ASCII_ESC, frames);
+
     return 0;
 }
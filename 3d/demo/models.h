@@ -14,1171 +14,1171 @@ typedef struct point_s
 
 const point_t cube[] =
 {
-    { -1.000000, -1.000000, -1.000000, 1 },
-    { 1.000000, -1.000000, -1.000000, 0 },
-    { 1.000000, 1.000000, -1.000000, 0 },
-    { -1.000000, 1.000000, -1.000000, 0 },
-    { -1.000000, -1.000000, -1.000000, 0 },
-    { -1.000000, -1.000000, 1.000000, 1 },
-    { 1.000000, -1.000000, 1.000000, 0 },
-    { 1.000000, 1.000000, 1.000000, 0 },
-    { -1.000000, 1.000000, 1.000000, 0 },
-    { -1.000000, -1.000000, 1.000000, 0 },
-    { -1.000000, -1.000000, -1.000000, 1 },
-    { -1.000000, -1.000000, 1.000000, 0 },
-    { 1.000000, -1.000000, -1.000000, 1 },
-    { 1.000000, -1.000000, 1.000000, 0 },
-    { 1.000000, 1.000000, -1.000000, 1 },
-    { 1.000000, 1.000000, 1.000000, 0 },
-    { -1.000000, 1.000000, -1.000000, 1 },
-    { -1.000000, 1.000000, 1.000000, 0 },
+    { FLOAT_C(-1.000000), FLOAT_C(-1.000000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(1.000000), FLOAT_C(-1.000000), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(1.000000), FLOAT_C(1.000000), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-1.000000), FLOAT_C(1.000000), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-1.000000), FLOAT_C(-1.000000), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-1.000000), FLOAT_C(-1.000000), FLOAT_C(1.000000), 1 },
+    { FLOAT_C(1.000000), FLOAT_C(-1.000000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.000000), FLOAT_C(1.000000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.000000), FLOAT_C(1.000000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.000000), FLOAT_C(-1.000000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.000000), FLOAT_C(-1.000000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-1.000000), FLOAT_C(-1.000000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.000000), FLOAT_C(-1.000000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(1.000000), FLOAT_C(-1.000000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.000000), FLOAT_C(1.000000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(1.000000), FLOAT_C(1.000000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.000000), FLOAT_C(1.000000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-1.000000), FLOAT_C(1.000000), FLOAT_C(1.000000), 0 },
 };
 // count=18 bytes=234
 
 
 const point_t icos[] =
 {
-    { 0.000000, 0.000000, 1.000000, 1 },
-    { 0.866025, 0.000000, 0.500000, 0 },
-    { 0.000000, 0.000000, -1.000000, 1 },
-    { 0.700629, 0.509037, -0.500000, 0 },
-    { 0.000000, 0.000000, 1.000000, 1 },
-    { 0.267617, 0.823639, 0.500000, 0 },
-    { 0.000000, 0.000000, -1.000000, 1 },
-    { -0.267617, 0.823639, -0.500000, 0 },
-    { 0.000000, 0.000000, 1.000000, 1 },
-    { -0.700629, 0.509037, 0.500000, 0 },
-    { 0.000000, 0.000000, -1.000000, 1 },
-    { -0.866025, 0.000000, -0.500000, 0 },
-    { 0.000000, 0.000000, 1.000000, 1 },
-    { -0.700629, -0.509037, 0.500000, 0 },
-    { 0.000000, 0.000000, -1.000000, 1 },
-    { -0.267617, -0.823639, -0.500000, 0 },
-    { 0.000000, 0.000000, 1.000000, 1 },
-    { 0.267617, -0.823639, 0.500000, 0 },
-    { 0.000000, 0.000000, -1.000000, 1 },
-    { 0.700629, -0.509037, -0.500000, 0 },
-    { 0.000000, 0.000000, 1.000000, 1 },
-    { 0.866025, -0.000000, 0.500000, 0 },
-    { 0.000000, 0.000000, -1.000000, 1 },
-    { 0.700629, 0.509037, -0.500000, 0 },
-    { 0.866025, 0.000000, 0.500000, 1 },
-    { 0.267617, 0.823639, 0.500000, 0 },
-    { -0.700629, 0.509037, 0.500000, 0 },
-    { -0.700629, -0.509037, 0.500000, 0 },
-    { 0.267617, -0.823639, 0.500000, 0 },
-    { 0.866025, -0.000000, 0.500000, 0 },
-    { 0.267617, 0.823639, 0.500000, 0 },
-    { 0.700629, 0.509037, -0.500000, 1 },
-    { -0.267617, 0.823639, -0.500000, 0 },
-    { -0.866025, 0.000000, -0.500000, 0 },
-    { -0.267617, -0.823639, -0.500000, 0 },
-    { 0.700629, -0.509037, -0.500000, 0 },
-    { 0.700629, 0.509037, -0.500000, 0 },
-    { -0.267617, 0.823639, -0.500000, 0 },
-    { 0.866025, 0.000000, 0.500000, 1 },
-    { 0.700629, 0.509037, -0.500000, 0 },
-    { 0.267617, 0.823639, 0.500000, 0 },
-    { -0.267617, 0.823639, -0.500000, 0 },
-    { -0.700629, 0.509037, 0.500000, 0 },
-    { -0.866025, 0.000000, -0.500000, 0 },
-    { -0.700629, -0.509037, 0.500000, 0 },
-    { -0.267617, -0.823639, -0.500000, 0 },
-    { 0.267617, -0.823639, 0.500000, 0 },
-    { 0.700629, -0.509037, -0.500000, 0 },
-    { 0.866025, -0.000000, 0.500000, 0 },
-    { 0.700629, 0.509037, -0.500000, 0 },
-    { 0.267617, 0.823639, 0.500000, 0 },
+    { FLOAT_C(0.000000), FLOAT_C(0.000000), FLOAT_C(1.000000), 1 },
+    { FLOAT_C(0.866025), FLOAT_C(0.000000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(0.000000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(0.700629), FLOAT_C(0.509037), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(0.000000), FLOAT_C(1.000000), 1 },
+    { FLOAT_C(0.267617), FLOAT_C(0.823639), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(0.000000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-0.267617), FLOAT_C(0.823639), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(0.000000), FLOAT_C(1.000000), 1 },
+    { FLOAT_C(-0.700629), FLOAT_C(0.509037), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(0.000000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-0.866025), FLOAT_C(0.000000), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(0.000000), FLOAT_C(1.000000), 1 },
+    { FLOAT_C(-0.700629), FLOAT_C(-0.509037), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(0.000000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-0.267617), FLOAT_C(-0.823639), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(0.000000), FLOAT_C(1.000000), 1 },
+    { FLOAT_C(0.267617), FLOAT_C(-0.823639), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(0.000000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(0.700629), FLOAT_C(-0.509037), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(0.000000), FLOAT_C(1.000000), 1 },
+    { FLOAT_C(0.866025), FLOAT_C(-0.000000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(0.000000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(0.700629), FLOAT_C(0.509037), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.866025), FLOAT_C(0.000000), FLOAT_C(0.500000), 1 },
+    { FLOAT_C(0.267617), FLOAT_C(0.823639), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.700629), FLOAT_C(0.509037), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.700629), FLOAT_C(-0.509037), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.267617), FLOAT_C(-0.823639), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.866025), FLOAT_C(-0.000000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.267617), FLOAT_C(0.823639), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.700629), FLOAT_C(0.509037), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-0.267617), FLOAT_C(0.823639), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.866025), FLOAT_C(0.000000), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.267617), FLOAT_C(-0.823639), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.700629), FLOAT_C(-0.509037), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.700629), FLOAT_C(0.509037), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.267617), FLOAT_C(0.823639), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.866025), FLOAT_C(0.000000), FLOAT_C(0.500000), 1 },
+    { FLOAT_C(0.700629), FLOAT_C(0.509037), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.267617), FLOAT_C(0.823639), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.267617), FLOAT_C(0.823639), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.700629), FLOAT_C(0.509037), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.866025), FLOAT_C(0.000000), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.700629), FLOAT_C(-0.509037), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.267617), FLOAT_C(-0.823639), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.267617), FLOAT_C(-0.823639), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.700629), FLOAT_C(-0.509037), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.866025), FLOAT_C(-0.000000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.700629), FLOAT_C(0.509037), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.267617), FLOAT_C(0.823639), FLOAT_C(0.500000), 0 },
 };
 // count=51 bytes=663
 
 
 const point_t gear[] =
 {
-    { 0.999465, 0.032719, -0.250000, 1 },
-    { 0.973877, 0.227076, -0.250000, 0 },
-    { 1.148328, 0.348342, -0.250000, 0 },
-    { 1.058306, 0.565676, -0.250000, 0 },
-    { 0.849202, 0.528068, -0.250000, 0 },
-    { 0.729864, 0.683592, -0.250000, 0 },
-    { 0.820311, 0.875837, -0.250000, 0 },
-    { 0.633681, 1.019043, -0.250000, 0 },
-    { 0.471397, 0.881921, -0.250000, 0 },
-    { 0.290285, 0.956940, -0.250000, 0 },
-    { 0.272492, 1.168652, -0.250000, 0 },
-    { 0.039263, 1.199358, -0.250000, 0 },
-    { -0.032719, 0.999465, -0.250000, 0 },
-    { -0.227076, 0.973877, -0.250000, 0 },
-    { -0.348342, 1.148328, -0.250000, 0 },
-    { -0.565676, 1.058306, -0.250000, 0 },
-    { -0.528068, 0.849202, -0.250000, 0 },
-    { -0.683592, 0.729864, -0.250000, 0 },
-    { -0.875837, 0.820311, -0.250000, 0 },
-    { -1.019043, 0.633681, -0.250000, 0 },
-    { -0.881921, 0.471397, -0.250000, 0 },
-    { -0.956940, 0.290285, -0.250000, 0 },
-    { -1.168652, 0.272492, -0.250000, 0 },
-    { -1.199358, 0.039263, -0.250000, 0 },
-    { -0.999465, -0.032719, -0.250000, 0 },
-    { -0.973877, -0.227076, -0.250000, 0 },
-    { -1.148328, -0.348342, -0.250000, 0 },
-    { -1.058306, -0.565676, -0.250000, 0 },
-    { -0.849202, -0.528068, -0.250000, 0 },
-    { -0.729864, -0.683592, -0.250000, 0 },
-    { -0.820311, -0.875837, -0.250000, 0 },
-    { -0.633681, -1.019043, -0.250000, 0 },
-    { -0.471397, -0.881921, -0.250000, 0 },
-    { -0.290285, -0.956940, -0.250000, 0 },
-    { -0.272492, -1.168652, -0.250000, 0 },
-    { -0.039263, -1.199358, -0.250000, 0 },
-    { 0.032719, -0.999465, -0.250000, 0 },
-    { 0.227076, -0.973877, -0.250000, 0 },
-    { 0.348342, -1.148328, -0.250000, 0 },
-    { 0.565676, -1.058306, -0.250000, 0 },
-    { 0.528068, -0.849202, -0.250000, 0 },
-    { 0.683592, -0.729864, -0.250000, 0 },
-    { 0.875837, -0.820311, -0.250000, 0 },
-    { 1.019043, -0.633681, -0.250000, 0 },
-    { 0.881921, -0.471397, -0.250000, 0 },
-    { 0.956940, -0.290285, -0.250000, 0 },
-    { 1.168652, -0.272492, -0.250000, 0 },
-    { 1.199358, -0.039263, -0.250000, 0 },
-    { 0.999465, 0.032719, -0.250000, 0 },
-    { 0.999465, 0.032719, 0.250000, 1 },
-    { 0.973877, 0.227076, 0.250000, 0 },
-    { 1.148328, 0.348342, 0.250000, 0 },
-    { 1.058306, 0.565676, 0.250000, 0 },
-    { 0.849202, 0.528068, 0.250000, 0 },
-    { 0.729864, 0.683592, 0.250000, 0 },
-    { 0.820311, 0.875837, 0.250000, 0 },
-    { 0.633681, 1.019043, 0.250000, 0 },
-    { 0.471397, 0.881921, 0.250000, 0 },
-    { 0.290285, 0.956940, 0.250000, 0 },
-    { 0.272492, 1.168652, 0.250000, 0 },
-    { 0.039263, 1.199358, 0.250000, 0 },
-    { -0.032719, 0.999465, 0.250000, 0 },
-    { -0.227076, 0.973877, 0.250000, 0 },
-    { -0.348342, 1.148328, 0.250000, 0 },
-    { -0.565676, 1.058306, 0.250000, 0 },
-    { -0.528068, 0.849202, 0.250000, 0 },
-    { -0.683592, 0.729864, 0.250000, 0 },
-    { -0.875837, 0.820311, 0.250000, 0 },
-    { -1.019043, 0.633681, 0.250000, 0 },
-    { -0.881921, 0.471397, 0.250000, 0 },
-    { -0.956940, 0.290285, 0.250000, 0 },
-    { -1.168652, 0.272492, 0.250000, 0 },
-    { -1.199358, 0.039263, 0.250000, 0 },
-    { -0.999465, -0.032719, 0.250000, 0 },
-    { -0.973877, -0.227076, 0.250000, 0 },
-    { -1.148328, -0.348342, 0.250000, 0 },
-    { -1.058306, -0.565676, 0.250000, 0 },
-    { -0.849202, -0.528068, 0.250000, 0 },
-    { -0.729864, -0.683592, 0.250000, 0 },
-    { -0.820311, -0.875837, 0.250000, 0 },
-    { -0.633681, -1.019043, 0.250000, 0 },
-    { -0.471397, -0.881921, 0.250000, 0 },
-    { -0.290285, -0.956940, 0.250000, 0 },
-    { -0.272492, -1.168652, 0.250000, 0 },
-    { -0.039263, -1.199358, 0.250000, 0 },
-    { 0.032719, -0.999465, 0.250000, 0 },
-    { 0.227076, -0.973877, 0.250000, 0 },
-    { 0.348342, -1.148328, 0.250000, 0 },
-    { 0.565676, -1.058306, 0.250000, 0 },
-    { 0.528068, -0.849202, 0.250000, 0 },
-    { 0.683592, -0.729864, 0.250000, 0 },
-    { 0.875837, -0.820311, 0.250000, 0 },
-    { 1.019043, -0.633681, 0.250000, 0 },
-    { 0.881921, -0.471397, 0.250000, 0 },
-    { 0.956940, -0.290285, 0.250000, 0 },
-    { 1.168652, -0.272492, 0.250000, 0 },
-    { 1.199358, -0.039263, 0.250000, 0 },
-    { 0.999465, 0.032719, 0.250000, 0 },
-    { 0.999465, 0.032719, -0.250000, 1 },
-    { 0.999465, 0.032719, 0.250000, 0 },
-    { 1.199358, -0.039263, -0.250000, 1 },
-    { 1.199358, -0.039263, 0.250000, 0 },
-    { 0.973877, 0.227076, -0.250000, 1 },
-    { 0.973877, 0.227076, 0.250000, 0 },
-    { 1.148328, 0.348342, -0.250000, 1 },
-    { 1.148328, 0.348342, 0.250000, 0 },
-    { 0.849202, 0.528068, -0.250000, 1 },
-    { 0.849202, 0.528068, 0.250000, 0 },
-    { 1.058306, 0.565676, -0.250000, 1 },
-    { 1.058306, 0.565676, 0.250000, 0 },
-    { 0.729864, 0.683592, -0.250000, 1 },
-    { 0.729864, 0.683592, 0.250000, 0 },
-    { 0.820311, 0.875837, -0.250000, 1 },
-    { 0.820311, 0.875837, 0.250000, 0 },
-    { 0.471397, 0.881921, -0.250000, 1 },
-    { 0.471397, 0.881921, 0.250000, 0 },
-    { 0.633681, 1.019043, -0.250000, 1 },
-    { 0.633681, 1.019043, 0.250000, 0 },
-    { 0.290285, 0.956940, -0.250000, 1 },
-    { 0.290285, 0.956940, 0.250000, 0 },
-    { 0.272492, 1.168652, -0.250000, 1 },
-    { 0.272492, 1.168652, 0.250000, 0 },
-    { -0.032719, 0.999465, -0.250000, 1 },
-    { -0.032719, 0.999465, 0.250000, 0 },
-    { 0.039263, 1.199358, -0.250000, 1 },
-    { 0.039263, 1.199358, 0.250000, 0 },
-    { -0.227076, 0.973877, -0.250000, 1 },
-    { -0.227076, 0.973877, 0.250000, 0 },
-    { -0.348342, 1.148328, -0.250000, 1 },
-    { -0.348342, 1.148328, 0.250000, 0 },
-    { -0.528068, 0.849202, -0.250000, 1 },
-    { -0.528068, 0.849202, 0.250000, 0 },
-    { -0.565676, 1.058306, -0.250000, 1 },
-    { -0.565676, 1.058306, 0.250000, 0 },
-    { -0.683592, 0.729864, -0.250000, 1 },
-    { -0.683592, 0.729864, 0.250000, 0 },
-    { -0.875837, 0.820311, -0.250000, 1 },
-    { -0.875837, 0.820311, 0.250000, 0 },
-    { -0.881921, 0.471397, -0.250000, 1 },
-    { -0.881921, 0.471397, 0.250000, 0 },
-    { -1.019043, 0.633681, -0.250000, 1 },
-    { -1.019043, 0.633681, 0.250000, 0 },
-    { -0.956940, 0.290285, -0.250000, 1 },
-    { -0.956940, 0.290285, 0.250000, 0 },
-    { -1.168652, 0.272492, -0.250000, 1 },
-    { -1.168652, 0.272492, 0.250000, 0 },
-    { -0.999465, -0.032719, -0.250000, 1 },
-    { -0.999465, -0.032719, 0.250000, 0 },
-    { -1.199358, 0.039263, -0.250000, 1 },
-    { -1.199358, 0.039263, 0.250000, 0 },
-    { -0.973877, -0.227076, -0.250000, 1 },
-    { -0.973877, -0.227076, 0.250000, 0 },
-    { -1.148328, -0.348342, -0.250000, 1 },
-    { -1.148328, -0.348342, 0.250000, 0 },
-    { -0.849202, -0.528068, -0.250000, 1 },
-    { -0.849202, -0.528068, 0.250000, 0 },
-    { -1.058306, -0.565676, -0.250000, 1 },
-    { -1.058306, -0.565676, 0.250000, 0 },
-    { -0.729864, -0.683592, -0.250000, 1 },
-    { -0.729864, -0.683592, 0.250000, 0 },
-    { -0.820311, -0.875837, -0.250000, 1 },
-    { -0.820311, -0.875837, 0.250000, 0 },
-    { -0.471397, -0.881921, -0.250000, 1 },
-    { -0.471397, -0.881921, 0.250000, 0 },
-    { -0.633681, -1.019043, -0.250000, 1 },
-    { -0.633681, -1.019043, 0.250000, 0 },
-    { -0.290285, -0.956940, -0.250000, 1 },
-    { -0.290285, -0.956940, 0.250000, 0 },
-    { -0.272492, -1.168652, -0.250000, 1 },
-    { -0.272492, -1.168652, 0.250000, 0 },
-    { 0.032719, -0.999465, -0.250000, 1 },
-    { 0.032719, -0.999465, 0.250000, 0 },
-    { -0.039263, -1.199358, -0.250000, 1 },
-    { -0.039263, -1.199358, 0.250000, 0 },
-    { 0.227076, -0.973877, -0.250000, 1 },
-    { 0.227076, -0.973877, 0.250000, 0 },
-    { 0.348342, -1.148328, -0.250000, 1 },
-    { 0.348342, -1.148328, 0.250000, 0 },
-    { 0.528068, -0.849202, -0.250000, 1 },
-    { 0.528068, -0.849202, 0.250000, 0 },
-    { 0.565676, -1.058306, -0.250000, 1 },
-    { 0.565676, -1.058306, 0.250000, 0 },
-    { 0.683592, -0.729864, -0.250000, 1 },
-    { 0.683592, -0.729864, 0.250000, 0 },
-    { 0.875837, -0.820311, -0.250000, 1 },
-    { 0.875837, -0.820311, 0.250000, 0 },
-    { 0.881921, -0.471397, -0.250000, 1 },
-    { 0.881921, -0.471397, 0.250000, 0 },
-    { 1.019043, -0.633681, -0.250000, 1 },
-    { 1.019043, -0.633681, 0.250000, 0 },
-    { 0.956940, -0.290285, -0.250000, 1 },
-    { 0.956940, -0.290285, 0.250000, 0 },
-    { 1.168652, -0.272492, -0.250000, 1 },
-    { 1.168652, -0.272492, 0.250000, 0 },
-    { -0.100000, -0.100000, -0.250000, 1 },
-    { 0.100000, -0.100000, -0.250000, 0 },
-    { 0.100000, 0.100000, -0.250000, 0 },
-    { -0.100000, 0.100000, -0.250000, 0 },
-    { -0.100000, -0.100000, -0.250000, 0 },
-    { -0.100000, -0.100000, 0.250000, 1 },
-    { 0.100000, -0.100000, 0.250000, 0 },
-    { 0.100000, 0.100000, 0.250000, 0 },
-    { -0.100000, 0.100000, 0.250000, 0 },
-    { -0.100000, -0.100000, 0.250000, 0 },
-    { -0.100000, -0.100000, -0.250000, 1 },
-    { -0.100000, -0.100000, 0.250000, 0 },
-    { 0.100000, -0.100000, -0.250000, 1 },
-    { 0.100000, -0.100000, 0.250000, 0 },
-    { 0.100000, 0.100000, -0.250000, 1 },
-    { 0.100000, 0.100000, 0.250000, 0 },
-    { -0.100000, 0.100000, -0.250000, 1 },
-    { -0.100000, 0.100000, 0.250000, 0 },
+    { FLOAT_C(0.999465), FLOAT_C(0.032719), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.973877), FLOAT_C(0.227076), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.148328), FLOAT_C(0.348342), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.058306), FLOAT_C(0.565676), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.849202), FLOAT_C(0.528068), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.729864), FLOAT_C(0.683592), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.820311), FLOAT_C(0.875837), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.633681), FLOAT_C(1.019043), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.471397), FLOAT_C(0.881921), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.290285), FLOAT_C(0.956940), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.272492), FLOAT_C(1.168652), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.039263), FLOAT_C(1.199358), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.032719), FLOAT_C(0.999465), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.227076), FLOAT_C(0.973877), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.348342), FLOAT_C(1.148328), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.565676), FLOAT_C(1.058306), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.528068), FLOAT_C(0.849202), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.683592), FLOAT_C(0.729864), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.875837), FLOAT_C(0.820311), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-1.019043), FLOAT_C(0.633681), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.881921), FLOAT_C(0.471397), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.956940), FLOAT_C(0.290285), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-1.168652), FLOAT_C(0.272492), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-1.199358), FLOAT_C(0.039263), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.999465), FLOAT_C(-0.032719), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.973877), FLOAT_C(-0.227076), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-1.148328), FLOAT_C(-0.348342), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-1.058306), FLOAT_C(-0.565676), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.849202), FLOAT_C(-0.528068), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.729864), FLOAT_C(-0.683592), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.820311), FLOAT_C(-0.875837), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.633681), FLOAT_C(-1.019043), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.471397), FLOAT_C(-0.881921), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.290285), FLOAT_C(-0.956940), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.272492), FLOAT_C(-1.168652), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.039263), FLOAT_C(-1.199358), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.032719), FLOAT_C(-0.999465), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.227076), FLOAT_C(-0.973877), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.348342), FLOAT_C(-1.148328), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.565676), FLOAT_C(-1.058306), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.528068), FLOAT_C(-0.849202), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.683592), FLOAT_C(-0.729864), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.875837), FLOAT_C(-0.820311), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.019043), FLOAT_C(-0.633681), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.881921), FLOAT_C(-0.471397), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.956940), FLOAT_C(-0.290285), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.168652), FLOAT_C(-0.272492), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.199358), FLOAT_C(-0.039263), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.999465), FLOAT_C(0.032719), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.999465), FLOAT_C(0.032719), FLOAT_C(0.250000), 1 },
+    { FLOAT_C(0.973877), FLOAT_C(0.227076), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.148328), FLOAT_C(0.348342), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.058306), FLOAT_C(0.565676), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.849202), FLOAT_C(0.528068), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.729864), FLOAT_C(0.683592), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.820311), FLOAT_C(0.875837), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.633681), FLOAT_C(1.019043), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.471397), FLOAT_C(0.881921), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.290285), FLOAT_C(0.956940), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.272492), FLOAT_C(1.168652), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.039263), FLOAT_C(1.199358), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.032719), FLOAT_C(0.999465), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.227076), FLOAT_C(0.973877), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.348342), FLOAT_C(1.148328), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.565676), FLOAT_C(1.058306), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.528068), FLOAT_C(0.849202), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.683592), FLOAT_C(0.729864), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.875837), FLOAT_C(0.820311), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.019043), FLOAT_C(0.633681), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.881921), FLOAT_C(0.471397), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.956940), FLOAT_C(0.290285), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.168652), FLOAT_C(0.272492), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.199358), FLOAT_C(0.039263), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.999465), FLOAT_C(-0.032719), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.973877), FLOAT_C(-0.227076), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.148328), FLOAT_C(-0.348342), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.058306), FLOAT_C(-0.565676), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.849202), FLOAT_C(-0.528068), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.729864), FLOAT_C(-0.683592), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.820311), FLOAT_C(-0.875837), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.633681), FLOAT_C(-1.019043), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.471397), FLOAT_C(-0.881921), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.290285), FLOAT_C(-0.956940), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.272492), FLOAT_C(-1.168652), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.039263), FLOAT_C(-1.199358), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.032719), FLOAT_C(-0.999465), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.227076), FLOAT_C(-0.973877), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.348342), FLOAT_C(-1.148328), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.565676), FLOAT_C(-1.058306), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.528068), FLOAT_C(-0.849202), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.683592), FLOAT_C(-0.729864), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.875837), FLOAT_C(-0.820311), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.019043), FLOAT_C(-0.633681), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.881921), FLOAT_C(-0.471397), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.956940), FLOAT_C(-0.290285), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.168652), FLOAT_C(-0.272492), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.199358), FLOAT_C(-0.039263), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.999465), FLOAT_C(0.032719), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.999465), FLOAT_C(0.032719), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.999465), FLOAT_C(0.032719), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.199358), FLOAT_C(-0.039263), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.199358), FLOAT_C(-0.039263), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.973877), FLOAT_C(0.227076), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.973877), FLOAT_C(0.227076), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.148328), FLOAT_C(0.348342), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.148328), FLOAT_C(0.348342), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.849202), FLOAT_C(0.528068), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.849202), FLOAT_C(0.528068), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.058306), FLOAT_C(0.565676), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.058306), FLOAT_C(0.565676), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.729864), FLOAT_C(0.683592), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.729864), FLOAT_C(0.683592), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.820311), FLOAT_C(0.875837), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.820311), FLOAT_C(0.875837), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.471397), FLOAT_C(0.881921), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.471397), FLOAT_C(0.881921), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.633681), FLOAT_C(1.019043), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.633681), FLOAT_C(1.019043), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.290285), FLOAT_C(0.956940), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.290285), FLOAT_C(0.956940), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.272492), FLOAT_C(1.168652), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.272492), FLOAT_C(1.168652), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.032719), FLOAT_C(0.999465), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.032719), FLOAT_C(0.999465), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.039263), FLOAT_C(1.199358), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.039263), FLOAT_C(1.199358), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.227076), FLOAT_C(0.973877), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.227076), FLOAT_C(0.973877), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.348342), FLOAT_C(1.148328), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.348342), FLOAT_C(1.148328), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.528068), FLOAT_C(0.849202), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.528068), FLOAT_C(0.849202), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.565676), FLOAT_C(1.058306), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.565676), FLOAT_C(1.058306), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.683592), FLOAT_C(0.729864), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.683592), FLOAT_C(0.729864), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.875837), FLOAT_C(0.820311), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.875837), FLOAT_C(0.820311), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.881921), FLOAT_C(0.471397), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.881921), FLOAT_C(0.471397), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.019043), FLOAT_C(0.633681), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-1.019043), FLOAT_C(0.633681), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.956940), FLOAT_C(0.290285), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.956940), FLOAT_C(0.290285), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.168652), FLOAT_C(0.272492), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-1.168652), FLOAT_C(0.272492), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.999465), FLOAT_C(-0.032719), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.999465), FLOAT_C(-0.032719), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.199358), FLOAT_C(0.039263), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-1.199358), FLOAT_C(0.039263), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.973877), FLOAT_C(-0.227076), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.973877), FLOAT_C(-0.227076), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.148328), FLOAT_C(-0.348342), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-1.148328), FLOAT_C(-0.348342), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.849202), FLOAT_C(-0.528068), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.849202), FLOAT_C(-0.528068), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.058306), FLOAT_C(-0.565676), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-1.058306), FLOAT_C(-0.565676), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.729864), FLOAT_C(-0.683592), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.729864), FLOAT_C(-0.683592), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.820311), FLOAT_C(-0.875837), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.820311), FLOAT_C(-0.875837), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.471397), FLOAT_C(-0.881921), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.471397), FLOAT_C(-0.881921), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.633681), FLOAT_C(-1.019043), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.633681), FLOAT_C(-1.019043), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.290285), FLOAT_C(-0.956940), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.290285), FLOAT_C(-0.956940), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.272492), FLOAT_C(-1.168652), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.272492), FLOAT_C(-1.168652), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.032719), FLOAT_C(-0.999465), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.032719), FLOAT_C(-0.999465), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.039263), FLOAT_C(-1.199358), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.039263), FLOAT_C(-1.199358), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.227076), FLOAT_C(-0.973877), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.227076), FLOAT_C(-0.973877), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.348342), FLOAT_C(-1.148328), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.348342), FLOAT_C(-1.148328), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.528068), FLOAT_C(-0.849202), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.528068), FLOAT_C(-0.849202), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.565676), FLOAT_C(-1.058306), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.565676), FLOAT_C(-1.058306), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.683592), FLOAT_C(-0.729864), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.683592), FLOAT_C(-0.729864), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.875837), FLOAT_C(-0.820311), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.875837), FLOAT_C(-0.820311), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.881921), FLOAT_C(-0.471397), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.881921), FLOAT_C(-0.471397), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.019043), FLOAT_C(-0.633681), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.019043), FLOAT_C(-0.633681), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.956940), FLOAT_C(-0.290285), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.956940), FLOAT_C(-0.290285), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.168652), FLOAT_C(-0.272492), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.168652), FLOAT_C(-0.272492), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.100000), FLOAT_C(-0.100000), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.100000), FLOAT_C(-0.100000), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.100000), FLOAT_C(0.100000), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.100000), FLOAT_C(0.100000), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.100000), FLOAT_C(-0.100000), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.100000), FLOAT_C(-0.100000), FLOAT_C(0.250000), 1 },
+    { FLOAT_C(0.100000), FLOAT_C(-0.100000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.100000), FLOAT_C(0.100000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.100000), FLOAT_C(0.100000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.100000), FLOAT_C(-0.100000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.100000), FLOAT_C(-0.100000), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.100000), FLOAT_C(-0.100000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.100000), FLOAT_C(-0.100000), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.100000), FLOAT_C(-0.100000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.100000), FLOAT_C(0.100000), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.100000), FLOAT_C(0.100000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.100000), FLOAT_C(0.100000), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.100000), FLOAT_C(0.100000), FLOAT_C(0.250000), 0 },
 };
 // count=212 bytes=2756
 
 
 const point_t glxgear1[] =
 {
-    { 3.650000, 0.000000, -0.500000, 1 },
-    { 4.336590, 0.341297, -0.500000, 0 },
-    { 4.296444, 0.680490, -0.500000, 0 },
-    { 3.549150, 0.852076, -0.500000, 0 },
-    { 3.471356, 1.127912, -0.500000, 0 },
-    { 4.018876, 1.664673, -0.500000, 0 },
-    { 3.875878, 1.974859, -0.500000, 0 },
-    { 3.112137, 1.907120, -0.500000, 0 },
-    { 2.952912, 2.145416, -0.500000, 0 },
-    { 3.307766, 2.825099, -0.500000, 0 },
-    { 3.075914, 3.075914, -0.500000, 0 },
-    { 2.370485, 2.775482, -0.500000, 0 },
-    { 2.145416, 2.952912, -0.500000, 0 },
-    { 2.272869, 3.708985, -0.500000, 0 },
-    { 1.974859, 3.875878, -0.500000, 0 },
-    { 1.396795, 3.372160, -0.500000, 0 },
-    { 1.127912, 3.471356, -0.500000, 0 },
-    { 1.015487, 4.229809, -0.500000, 0 },
-    { 0.680490, 4.296444, -0.500000, 0 },
-    { 0.286376, 3.638748, -0.500000, 0 },
-    { 0.000000, 3.650000, -0.500000, 0 },
-    { -0.341297, 4.336590, -0.500000, 0 },
-    { -0.680490, 4.296444, -0.500000, 0 },
-    { -0.852076, 3.549150, -0.500000, 0 },
-    { -1.127912, 3.471356, -0.500000, 0 },
-    { -1.664673, 4.018876, -0.500000, 0 },
-    { -1.974859, 3.875878, -0.500000, 0 },
-    { -1.907120, 3.112137, -0.500000, 0 },
-    { -2.145416, 2.952912, -0.500000, 0 },
-    { -2.825099, 3.307766, -0.500000, 0 },
-    { -3.075914, 3.075914, -0.500000, 0 },
-    { -2.775482, 2.370485, -0.500000, 0 },
-    { -2.952912, 2.145416, -0.500000, 0 },
-    { -3.708985, 2.272869, -0.500000, 0 },
-    { -3.875878, 1.974859, -0.500000, 0 },
-    { -3.372160, 1.396795, -0.500000, 0 },
-    { -3.471356, 1.127912, -0.500000, 0 },
-    { -4.229809, 1.015487, -0.500000, 0 },
-    { -4.296444, 0.680490, -0.500000, 0 },
-    { -3.638748, 0.286376, -0.500000, 0 },
-    { -3.650000, 0.000000, -0.500000, 0 },
-    { -4.336590, -0.341297, -0.500000, 0 },
-    { -4.296444, -0.680490, -0.500000, 0 },
-    { -3.549150, -0.852076, -0.500000, 0 },
-    { -3.471356, -1.127912, -0.500000, 0 },
-    { -4.018876, -1.664673, -0.500000, 0 },
-    { -3.875878, -1.974859, -0.500000, 0 },
-    { -3.112137, -1.907120, -0.500000, 0 },
-    { -2.952912, -2.145416, -0.500000, 0 },
-    { -3.307766, -2.825099, -0.500000, 0 },
-    { -3.075914, -3.075914, -0.500000, 0 },
-    { -2.370485, -2.775482, -0.500000, 0 },
-    { -2.145416, -2.952912, -0.500000, 0 },
-    { -2.272869, -3.708985, -0.500000, 0 },
-    { -1.974859, -3.875878, -0.500000, 0 },
-    { -1.396795, -3.372160, -0.500000, 0 },
-    { -1.127912, -3.471356, -0.500000, 0 },
-    { -1.015487, -4.229809, -0.500000, 0 },
-    { -0.680490, -4.296444, -0.500000, 0 },
-    { -0.286376, -3.638748, -0.500000, 0 },
-    { -0.000000, -3.650000, -0.500000, 0 },
-    { 0.341297, -4.336590, -0.500000, 0 },
-    { 0.680490, -4.296444, -0.500000, 0 },
-    { 0.852076, -3.549150, -0.500000, 0 },
-    { 1.127912, -3.471356, -0.500000, 0 },
-    { 1.664673, -4.018876, -0.500000, 0 },
-    { 1.974859, -3.875878, -0.500000, 0 },
-    { 1.907120, -3.112137, -0.500000, 0 },
-    { 2.145416, -2.952912, -0.500000, 0 },
-    { 2.825099, -3.307766, -0.500000, 0 },
-    { 3.075914, -3.075914, -0.500000, 0 },
-    { 2.775482, -2.370485, -0.500000, 0 },
-    { 2.952912, -2.145416, -0.500000, 0 },
-    { 3.708985, -2.272869, -0.500000, 0 },
-    { 3.875878, -1.974859, -0.500000, 0 },
-    { 3.372160, -1.396795, -0.500000, 0 },
-    { 3.471356, -1.127912, -0.500000, 0 },
-    { 4.229809, -1.015487, -0.500000, 0 },
-    { 4.296444, -0.680490, -0.500000, 0 },
-    { 3.638748, -0.286376, -0.500000, 0 },
-    { 3.650000, -0.000000, -0.500000, 0 },
-    { 4.336590, 0.341297, -0.500000, 0 },
-    { 4.296444, 0.680490, -0.500000, 0 },
-    { 3.549150, 0.852076, -0.500000, 0 },
-    { 1.000000, 0.000000, -0.500000, 1 },
-    { 0.951057, 0.309017, -0.500000, 0 },
-    { 0.809017, 0.587785, -0.500000, 0 },
-    { 0.587785, 0.809017, -0.500000, 0 },
-    { 0.309017, 0.951057, -0.500000, 0 },
-    { 0.000000, 1.000000, -0.500000, 0 },
-    { -0.309017, 0.951057, -0.500000, 0 },
-    { -0.587785, 0.809017, -0.500000, 0 },
-    { -0.809017, 0.587785, -0.500000, 0 },
-    { -0.951057, 0.309017, -0.500000, 0 },
-    { -1.000000, 0.000000, -0.500000, 0 },
-    { -0.951057, -0.309017, -0.500000, 0 },
-    { -0.809017, -0.587785, -0.500000, 0 },
-    { -0.587785, -0.809017, -0.500000, 0 },
-    { -0.309017, -0.951057, -0.500000, 0 },
-    { -0.000000, -1.000000, -0.500000, 0 },
-    { 0.309017, -0.951057, -0.500000, 0 },
-    { 0.587785, -0.809017, -0.500000, 0 },
-    { 0.809017, -0.587785, -0.500000, 0 },
-    { 0.951057, -0.309017, -0.500000, 0 },
-    { 1.000000, -0.000000, -0.500000, 0 },
-    { 3.650000, 0.000000, 0.500000, 1 },
-    { 4.336590, 0.341297, 0.500000, 0 },
-    { 4.296444, 0.680490, 0.500000, 0 },
-    { 3.549150, 0.852076, 0.500000, 0 },
-    { 3.471356, 1.127912, 0.500000, 0 },
-    { 4.018876, 1.664673, 0.500000, 0 },
-    { 3.875878, 1.974859, 0.500000, 0 },
-    { 3.112137, 1.907120, 0.500000, 0 },
-    { 2.952912, 2.145416, 0.500000, 0 },
-    { 3.307766, 2.825099, 0.500000, 0 },
-    { 3.075914, 3.075914, 0.500000, 0 },
-    { 2.370485, 2.775482, 0.500000, 0 },
-    { 2.145416, 2.952912, 0.500000, 0 },
-    { 2.272869, 3.708985, 0.500000, 0 },
-    { 1.974859, 3.875878, 0.500000, 0 },
-    { 1.396795, 3.372160, 0.500000, 0 },
-    { 1.127912, 3.471356, 0.500000, 0 },
-    { 1.015487, 4.229809, 0.500000, 0 },
-    { 0.680490, 4.296444, 0.500000, 0 },
-    { 0.286376, 3.638748, 0.500000, 0 },
-    { 0.000000, 3.650000, 0.500000, 0 },
-    { -0.341297, 4.336590, 0.500000, 0 },
-    { -0.680490, 4.296444, 0.500000, 0 },
-    { -0.852076, 3.549150, 0.500000, 0 },
-    { -1.127912, 3.471356, 0.500000, 0 },
-    { -1.664673, 4.018876, 0.500000, 0 },
-    { -1.974859, 3.875878, 0.500000, 0 },
-    { -1.907120, 3.112137, 0.500000, 0 },
-    { -2.145416, 2.952912, 0.500000, 0 },
-    { -2.825099, 3.307766, 0.500000, 0 },
-    { -3.075914, 3.075914, 0.500000, 0 },
-    { -2.775482, 2.370485, 0.500000, 0 },
-    { -2.952912, 2.145416, 0.500000, 0 },
-    { -3.708985, 2.272869, 0.500000, 0 },
-    { -3.875878, 1.974859, 0.500000, 0 },
-    { -3.372160, 1.396795, 0.500000, 0 },
-    { -3.471356, 1.127912, 0.500000, 0 },
-    { -4.229809, 1.015487, 0.500000, 0 },
-    { -4.296444, 0.680490, 0.500000, 0 },
-    { -3.638748, 0.286376, 0.500000, 0 },
-    { -3.650000, 0.000000, 0.500000, 0 },
-    { -4.336590, -0.341297, 0.500000, 0 },
-    { -4.296444, -0.680490, 0.500000, 0 },
-    { -3.549150, -0.852076, 0.500000, 0 },
-    { -3.471356, -1.127912, 0.500000, 0 },
-    { -4.018876, -1.664673, 0.500000, 0 },
-    { -3.875878, -1.974859, 0.500000, 0 },
-    { -3.112137, -1.907120, 0.500000, 0 },
-    { -2.952912, -2.145416, 0.500000, 0 },
-    { -3.307766, -2.825099, 0.500000, 0 },
-    { -3.075914, -3.075914, 0.500000, 0 },
-    { -2.370485, -2.775482, 0.500000, 0 },
-    { -2.145416, -2.952912, 0.500000, 0 },
-    { -2.272869, -3.708985, 0.500000, 0 },
-    { -1.974859, -3.875878, 0.500000, 0 },
-    { -1.396795, -3.372160, 0.500000, 0 },
-    { -1.127912, -3.471356, 0.500000, 0 },
-    { -1.015487, -4.229809, 0.500000, 0 },
-    { -0.680490, -4.296444, 0.500000, 0 },
-    { -0.286376, -3.638748, 0.500000, 0 },
-    { -0.000000, -3.650000, 0.500000, 0 },
-    { 0.341297, -4.336590, 0.500000, 0 },
-    { 0.680490, -4.296444, 0.500000, 0 },
-    { 0.852076, -3.549150, 0.500000, 0 },
-    { 1.127912, -3.471356, 0.500000, 0 },
-    { 1.664673, -4.018876, 0.500000, 0 },
-    { 1.974859, -3.875878, 0.500000, 0 },
-    { 1.907120, -3.112137, 0.500000, 0 },
-    { 2.145416, -2.952912, 0.500000, 0 },
-    { 2.825099, -3.307766, 0.500000, 0 },
-    { 3.075914, -3.075914, 0.500000, 0 },
-    { 2.775482, -2.370485, 0.500000, 0 },
-    { 2.952912, -2.145416, 0.500000, 0 },
-    { 3.708985, -2.272869, 0.500000, 0 },
-    { 3.875878, -1.974859, 0.500000, 0 },
-    { 3.372160, -1.396795, 0.500000, 0 },
-    { 3.471356, -1.127912, 0.500000, 0 },
-    { 4.229809, -1.015487, 0.500000, 0 },
-    { 4.296444, -0.680490, 0.500000, 0 },
-    { 3.638748, -0.286376, 0.500000, 0 },
-    { 3.650000, -0.000000, 0.500000, 0 },
-    { 4.336590, 0.341297, 0.500000, 0 },
-    { 4.296444, 0.680490, 0.500000, 0 },
-    { 3.549150, 0.852076, 0.500000, 0 },
-    { 1.000000, 0.000000, 0.500000, 1 },
-    { 0.951057, 0.309017, 0.500000, 0 },
-    { 0.809017, 0.587785, 0.500000, 0 },
-    { 0.587785, 0.809017, 0.500000, 0 },
-    { 0.309017, 0.951057, 0.500000, 0 },
-    { 0.000000, 1.000000, 0.500000, 0 },
-    { -0.309017, 0.951057, 0.500000, 0 },
-    { -0.587785, 0.809017, 0.500000, 0 },
-    { -0.809017, 0.587785, 0.500000, 0 },
-    { -0.951057, 0.309017, 0.500000, 0 },
-    { -1.000000, 0.000000, 0.500000, 0 },
-    { -0.951057, -0.309017, 0.500000, 0 },
-    { -0.809017, -0.587785, 0.500000, 0 },
-    { -0.587785, -0.809017, 0.500000, 0 },
-    { -0.309017, -0.951057, 0.500000, 0 },
-    { -0.000000, -1.000000, 0.500000, 0 },
-    { 0.309017, -0.951057, 0.500000, 0 },
-    { 0.587785, -0.809017, 0.500000, 0 },
-    { 0.809017, -0.587785, 0.500000, 0 },
-    { 0.951057, -0.309017, 0.500000, 0 },
-    { 1.000000, -0.000000, 0.500000, 0 },
-    { 3.650000, 0.000000, -0.500000, 1 },
-    { 3.650000, 0.000000, 0.500000, 0 },
-    { 4.336590, 0.341297, -0.500000, 1 },
-    { 4.336590, 0.341297, 0.500000, 0 },
-    { 4.296444, 0.680490, -0.500000, 1 },
-    { 4.296444, 0.680490, 0.500000, 0 },
-    { 3.549150, 0.852076, -0.500000, 1 },
-    { 3.549150, 0.852076, 0.500000, 0 },
-    { 1.000000, 0.000000, -0.500000, 1 },
-    { 1.000000, 0.000000, 0.500000, 0 },
-    { 3.471356, 1.127912, -0.500000, 1 },
-    { 3.471356, 1.127912, 0.500000, 0 },
-    { 4.018876, 1.664673, -0.500000, 1 },
-    { 4.018876, 1.664673, 0.500000, 0 },
-    { 3.875878, 1.974859, -0.500000, 1 },
-    { 3.875878, 1.974859, 0.500000, 0 },
-    { 3.112137, 1.907120, -0.500000, 1 },
-    { 3.112137, 1.907120, 0.500000, 0 },
-    { 0.951057, 0.309017, -0.500000, 1 },
-    { 0.951057, 0.309017, 0.500000, 0 },
-    { 2.952912, 2.145416, -0.500000, 1 },
-    { 2.952912, 2.145416, 0.500000, 0 },
-    { 3.307766, 2.825099, -0.500000, 1 },
-    { 3.307766, 2.825099, 0.500000, 0 },
-    { 3.075914, 3.075914, -0.500000, 1 },
-    { 3.075914, 3.075914, 0.500000, 0 },
-    { 2.370485, 2.775482, -0.500000, 1 },
-    { 2.370485, 2.775482, 0.500000, 0 },
-    { 0.809017, 0.587785, -0.500000, 1 },
-    { 0.809017, 0.587785, 0.500000, 0 },
-    { 2.145416, 2.952912, -0.500000, 1 },
-    { 2.145416, 2.952912, 0.500000, 0 },
-    { 2.272869, 3.708985, -0.500000, 1 },
-    { 2.272869, 3.708985, 0.500000, 0 },
-    { 1.974859, 3.875878, -0.500000, 1 },
-    { 1.974859, 3.875878, 0.500000, 0 },
-    { 1.396795, 3.372160, -0.500000, 1 },
-    { 1.396795, 3.372160, 0.500000, 0 },
-    { 0.587785, 0.809017, -0.500000, 1 },
-    { 0.587785, 0.809017, 0.500000, 0 },
-    { 1.127912, 3.471356, -0.500000, 1 },
-    { 1.127912, 3.471356, 0.500000, 0 },
-    { 1.015487, 4.229809, -0.500000, 1 },
-    { 1.015487, 4.229809, 0.500000, 0 },
-    { 0.680490, 4.296444, -0.500000, 1 },
-    { 0.680490, 4.296444, 0.500000, 0 },
-    { 0.286376, 3.638748, -0.500000, 1 },
-    { 0.286376, 3.638748, 0.500000, 0 },
-    { 0.309017, 0.951057, -0.500000, 1 },
-    { 0.309017, 0.951057, 0.500000, 0 },
-    { 0.000000, 3.650000, -0.500000, 1 },
-    { 0.000000, 3.650000, 0.500000, 0 },
-    { -0.341297, 4.336590, -0.500000, 1 },
-    { -0.341297, 4.336590, 0.500000, 0 },
-    { -0.680490, 4.296444, -0.500000, 1 },
-    { -0.680490, 4.296444, 0.500000, 0 },
-    { -0.852076, 3.549150, -0.500000, 1 },
-    { -0.852076, 3.549150, 0.500000, 0 },
-    { 0.000000, 1.000000, -0.500000, 1 },
-    { 0.000000, 1.000000, 0.500000, 0 },
-    { -1.127912, 3.471356, -0.500000, 1 },
-    { -1.127912, 3.471356, 0.500000, 0 },
-    { -1.664673, 4.018876, -0.500000, 1 },
-    { -1.664673, 4.018876, 0.500000, 0 },
-    { -1.974859, 3.875878, -0.500000, 1 },
-    { -1.974859, 3.875878, 0.500000, 0 },
-    { -1.907120, 3.112137, -0.500000, 1 },
-    { -1.907120, 3.112137, 0.500000, 0 },
-    { -0.309017, 0.951057, -0.500000, 1 },
-    { -0.309017, 0.951057, 0.500000, 0 },
-    { -2.145416, 2.952912, -0.500000, 1 },
-    { -2.145416, 2.952912, 0.500000, 0 },
-    { -2.825099, 3.307766, -0.500000, 1 },
-    { -2.825099, 3.307766, 0.500000, 0 },
-    { -3.075914, 3.075914, -0.500000, 1 },
-    { -3.075914, 3.075914, 0.500000, 0 },
-    { -2.775482, 2.370485, -0.500000, 1 },
-    { -2.775482, 2.370485, 0.500000, 0 },
-    { -0.587785, 0.809017, -0.500000, 1 },
-    { -0.587785, 0.809017, 0.500000, 0 },
-    { -2.952912, 2.145416, -0.500000, 1 },
-    { -2.952912, 2.145416, 0.500000, 0 },
-    { -3.708985, 2.272869, -0.500000, 1 },
-    { -3.708985, 2.272869, 0.500000, 0 },
-    { -3.875878, 1.974859, -0.500000, 1 },
-    { -3.875878, 1.974859, 0.500000, 0 },
-    { -3.372160, 1.396795, -0.500000, 1 },
-    { -3.372160, 1.396795, 0.500000, 0 },
-    { -0.809017, 0.587785, -0.500000, 1 },
-    { -0.809017, 0.587785, 0.500000, 0 },
-    { -3.471356, 1.127912, -0.500000, 1 },
-    { -3.471356, 1.127912, 0.500000, 0 },
-    { -4.229809, 1.015487, -0.500000, 1 },
-    { -4.229809, 1.015487, 0.500000, 0 },
-    { -4.296444, 0.680490, -0.500000, 1 },
-    { -4.296444, 0.680490, 0.500000, 0 },
-    { -3.638748, 0.286376, -0.500000, 1 },
-    { -3.638748, 0.286376, 0.500000, 0 },
-    { -0.951057, 0.309017, -0.500000, 1 },
-    { -0.951057, 0.309017, 0.500000, 0 },
-    { -3.650000, 0.000000, -0.500000, 1 },
-    { -3.650000, 0.000000, 0.500000, 0 },
-    { -4.336590, -0.341297, -0.500000, 1 },
-    { -4.336590, -0.341297, 0.500000, 0 },
-    { -4.296444, -0.680490, -0.500000, 1 },
-    { -4.296444, -0.680490, 0.500000, 0 },
-    { -3.549150, -0.852076, -0.500000, 1 },
-    { -3.549150, -0.852076, 0.500000, 0 },
-    { -1.000000, 0.000000, -0.500000, 1 },
-    { -1.000000, 0.000000, 0.500000, 0 },
-    { -3.471356, -1.127912, -0.500000, 1 },
-    { -3.471356, -1.127912, 0.500000, 0 },
-    { -4.018876, -1.664673, -0.500000, 1 },
-    { -4.018876, -1.664673, 0.500000, 0 },
-    { -3.875878, -1.974859, -0.500000, 1 },
-    { -3.875878, -1.974859, 0.500000, 0 },
-    { -3.112137, -1.907120, -0.500000, 1 },
-    { -3.112137, -1.907120, 0.500000, 0 },
-    { -0.951057, -0.309017, -0.500000, 1 },
-    { -0.951057, -0.309017, 0.500000, 0 },
-    { -2.952912, -2.145416, -0.500000, 1 },
-    { -2.952912, -2.145416, 0.500000, 0 },
-    { -3.307766, -2.825099, -0.500000, 1 },
-    { -3.307766, -2.825099, 0.500000, 0 },
-    { -3.075914, -3.075914, -0.500000, 1 },
-    { -3.075914, -3.075914, 0.500000, 0 },
-    { -2.370485, -2.775482, -0.500000, 1 },
-    { -2.370485, -2.775482, 0.500000, 0 },
-    { -0.809017, -0.587785, -0.500000, 1 },
-    { -0.809017, -0.587785, 0.500000, 0 },
-    { -2.145416, -2.952912, -0.500000, 1 },
-    { -2.145416, -2.952912, 0.500000, 0 },
-    { -2.272869, -3.708985, -0.500000, 1 },
-    { -2.272869, -3.708985, 0.500000, 0 },
-    { -1.974859, -3.875878, -0.500000, 1 },
-    { -1.974859, -3.875878, 0.500000, 0 },
-    { -1.396795, -3.372160, -0.500000, 1 },
-    { -1.396795, -3.372160, 0.500000, 0 },
-    { -0.587785, -0.809017, -0.500000, 1 },
-    { -0.587785, -0.809017, 0.500000, 0 },
-    { -1.127912, -3.471356, -0.500000, 1 },
-    { -1.127912, -3.471356, 0.500000, 0 },
-    { -1.015487, -4.229809, -0.500000, 1 },
-    { -1.015487, -4.229809, 0.500000, 0 },
-    { -0.680490, -4.296444, -0.500000, 1 },
-    { -0.680490, -4.296444, 0.500000, 0 },
-    { -0.286376, -3.638748, -0.500000, 1 },
-    { -0.286376, -3.638748, 0.500000, 0 },
-    { -0.309017, -0.951057, -0.500000, 1 },
-    { -0.309017, -0.951057, 0.500000, 0 },
-    { -0.000000, -3.650000, -0.500000, 1 },
-    { -0.000000, -3.650000, 0.500000, 0 },
-    { 0.341297, -4.336590, -0.500000, 1 },
-    { 0.341297, -4.336590, 0.500000, 0 },
-    { 0.680490, -4.296444, -0.500000, 1 },
-    { 0.680490, -4.296444, 0.500000, 0 },
-    { 0.852076, -3.549150, -0.500000, 1 },
-    { 0.852076, -3.549150, 0.500000, 0 },
-    { -0.000000, -1.000000, -0.500000, 1 },
-    { -0.000000, -1.000000, 0.500000, 0 },
-    { 1.127912, -3.471356, -0.500000, 1 },
-    { 1.127912, -3.471356, 0.500000, 0 },
-    { 1.664673, -4.018876, -0.500000, 1 },
-    { 1.664673, -4.018876, 0.500000, 0 },
-    { 1.974859, -3.875878, -0.500000, 1 },
-    { 1.974859, -3.875878, 0.500000, 0 },
-    { 1.907120, -3.112137, -0.500000, 1 },
-    { 1.907120, -3.112137, 0.500000, 0 },
-    { 0.309017, -0.951057, -0.500000, 1 },
-    { 0.309017, -0.951057, 0.500000, 0 },
-    { 2.145416, -2.952912, -0.500000, 1 },
-    { 2.145416, -2.952912, 0.500000, 0 },
-    { 2.825099, -3.307766, -0.500000, 1 },
-    { 2.825099, -3.307766, 0.500000, 0 },
-    { 3.075914, -3.075914, -0.500000, 1 },
-    { 3.075914, -3.075914, 0.500000, 0 },
-    { 2.775482, -2.370485, -0.500000, 1 },
-    { 2.775482, -2.370485, 0.500000, 0 },
-    { 0.587785, -0.809017, -0.500000, 1 },
-    { 0.587785, -0.809017, 0.500000, 0 },
-    { 2.952912, -2.145416, -0.500000, 1 },
-    { 2.952912, -2.145416, 0.500000, 0 },
-    { 3.708985, -2.272869, -0.500000, 1 },
-    { 3.708985, -2.272869, 0.500000, 0 },
-    { 3.875878, -1.974859, -0.500000, 1 },
-    { 3.875878, -1.974859, 0.500000, 0 },
-    { 3.372160, -1.396795, -0.500000, 1 },
-    { 3.372160, -1.396795, 0.500000, 0 },
-    { 0.809017, -0.587785, -0.500000, 1 },
-    { 0.809017, -0.587785, 0.500000, 0 },
-    { 3.471356, -1.127912, -0.500000, 1 },
-    { 3.471356, -1.127912, 0.500000, 0 },
-    { 4.229809, -1.015487, -0.500000, 1 },
-    { 4.229809, -1.015487, 0.500000, 0 },
-    { 4.296444, -0.680490, -0.500000, 1 },
-    { 4.296444, -0.680490, 0.500000, 0 },
-    { 3.638748, -0.286376, -0.500000, 1 },
-    { 3.638748, -0.286376, 0.500000, 0 },
-    { 0.951057, -0.309017, -0.500000, 1 },
-    { 0.951057, -0.309017, 0.500000, 0 },
-    { 3.650000, -0.000000, -0.500000, 1 },
-    { 3.650000, -0.000000, 0.500000, 0 },
-    { 4.336590, 0.341297, -0.500000, 1 },
-    { 4.336590, 0.341297, 0.500000, 0 },
-    { 4.296444, 0.680490, -0.500000, 1 },
-    { 4.296444, 0.680490, 0.500000, 0 },
-    { 3.549150, 0.852076, -0.500000, 1 },
-    { 3.549150, 0.852076, 0.500000, 0 },
+    { FLOAT_C(3.650000), FLOAT_C(0.000000), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(4.336590), FLOAT_C(0.341297), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(4.296444), FLOAT_C(0.680490), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(3.549150), FLOAT_C(0.852076), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(3.471356), FLOAT_C(1.127912), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(4.018876), FLOAT_C(1.664673), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(3.875878), FLOAT_C(1.974859), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(3.112137), FLOAT_C(1.907120), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(2.952912), FLOAT_C(2.145416), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(3.307766), FLOAT_C(2.825099), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(3.075914), FLOAT_C(3.075914), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(2.370485), FLOAT_C(2.775482), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(2.145416), FLOAT_C(2.952912), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(2.272869), FLOAT_C(3.708985), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(1.974859), FLOAT_C(3.875878), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(1.396795), FLOAT_C(3.372160), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(1.127912), FLOAT_C(3.471356), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(1.015487), FLOAT_C(4.229809), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.680490), FLOAT_C(4.296444), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.286376), FLOAT_C(3.638748), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(3.650000), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.341297), FLOAT_C(4.336590), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.680490), FLOAT_C(4.296444), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.852076), FLOAT_C(3.549150), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-1.127912), FLOAT_C(3.471356), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-1.664673), FLOAT_C(4.018876), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-1.974859), FLOAT_C(3.875878), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-1.907120), FLOAT_C(3.112137), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-2.145416), FLOAT_C(2.952912), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-2.825099), FLOAT_C(3.307766), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-3.075914), FLOAT_C(3.075914), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-2.775482), FLOAT_C(2.370485), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-2.952912), FLOAT_C(2.145416), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-3.708985), FLOAT_C(2.272869), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-3.875878), FLOAT_C(1.974859), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-3.372160), FLOAT_C(1.396795), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-3.471356), FLOAT_C(1.127912), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-4.229809), FLOAT_C(1.015487), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-4.296444), FLOAT_C(0.680490), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-3.638748), FLOAT_C(0.286376), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-3.650000), FLOAT_C(0.000000), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-4.336590), FLOAT_C(-0.341297), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-4.296444), FLOAT_C(-0.680490), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-3.549150), FLOAT_C(-0.852076), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-3.471356), FLOAT_C(-1.127912), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-4.018876), FLOAT_C(-1.664673), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-3.875878), FLOAT_C(-1.974859), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-3.112137), FLOAT_C(-1.907120), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-2.952912), FLOAT_C(-2.145416), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-3.307766), FLOAT_C(-2.825099), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-3.075914), FLOAT_C(-3.075914), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-2.370485), FLOAT_C(-2.775482), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-2.145416), FLOAT_C(-2.952912), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-2.272869), FLOAT_C(-3.708985), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-1.974859), FLOAT_C(-3.875878), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-1.396795), FLOAT_C(-3.372160), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-1.127912), FLOAT_C(-3.471356), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-1.015487), FLOAT_C(-4.229809), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.680490), FLOAT_C(-4.296444), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.286376), FLOAT_C(-3.638748), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.000000), FLOAT_C(-3.650000), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.341297), FLOAT_C(-4.336590), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.680490), FLOAT_C(-4.296444), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.852076), FLOAT_C(-3.549150), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(1.127912), FLOAT_C(-3.471356), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(1.664673), FLOAT_C(-4.018876), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(1.974859), FLOAT_C(-3.875878), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(1.907120), FLOAT_C(-3.112137), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(2.145416), FLOAT_C(-2.952912), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(2.825099), FLOAT_C(-3.307766), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(3.075914), FLOAT_C(-3.075914), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(2.775482), FLOAT_C(-2.370485), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(2.952912), FLOAT_C(-2.145416), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(3.708985), FLOAT_C(-2.272869), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(3.875878), FLOAT_C(-1.974859), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(3.372160), FLOAT_C(-1.396795), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(3.471356), FLOAT_C(-1.127912), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(4.229809), FLOAT_C(-1.015487), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(4.296444), FLOAT_C(-0.680490), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(3.638748), FLOAT_C(-0.286376), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(3.650000), FLOAT_C(-0.000000), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(4.336590), FLOAT_C(0.341297), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(4.296444), FLOAT_C(0.680490), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(3.549150), FLOAT_C(0.852076), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(1.000000), FLOAT_C(0.000000), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(0.951057), FLOAT_C(0.309017), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.809017), FLOAT_C(0.587785), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.587785), FLOAT_C(0.809017), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.309017), FLOAT_C(0.951057), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(1.000000), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.309017), FLOAT_C(0.951057), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.587785), FLOAT_C(0.809017), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.809017), FLOAT_C(0.587785), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.951057), FLOAT_C(0.309017), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-1.000000), FLOAT_C(0.000000), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.951057), FLOAT_C(-0.309017), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.809017), FLOAT_C(-0.587785), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.587785), FLOAT_C(-0.809017), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.309017), FLOAT_C(-0.951057), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(-0.000000), FLOAT_C(-1.000000), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.309017), FLOAT_C(-0.951057), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.587785), FLOAT_C(-0.809017), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.809017), FLOAT_C(-0.587785), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(0.951057), FLOAT_C(-0.309017), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(1.000000), FLOAT_C(-0.000000), FLOAT_C(-0.500000), 0 },
+    { FLOAT_C(3.650000), FLOAT_C(0.000000), FLOAT_C(0.500000), 1 },
+    { FLOAT_C(4.336590), FLOAT_C(0.341297), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(4.296444), FLOAT_C(0.680490), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.549150), FLOAT_C(0.852076), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.471356), FLOAT_C(1.127912), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(4.018876), FLOAT_C(1.664673), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.875878), FLOAT_C(1.974859), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.112137), FLOAT_C(1.907120), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(2.952912), FLOAT_C(2.145416), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.307766), FLOAT_C(2.825099), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.075914), FLOAT_C(3.075914), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(2.370485), FLOAT_C(2.775482), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(2.145416), FLOAT_C(2.952912), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(2.272869), FLOAT_C(3.708985), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.974859), FLOAT_C(3.875878), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.396795), FLOAT_C(3.372160), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.127912), FLOAT_C(3.471356), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.015487), FLOAT_C(4.229809), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.680490), FLOAT_C(4.296444), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.286376), FLOAT_C(3.638748), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(3.650000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.341297), FLOAT_C(4.336590), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.680490), FLOAT_C(4.296444), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.852076), FLOAT_C(3.549150), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-1.127912), FLOAT_C(3.471356), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-1.664673), FLOAT_C(4.018876), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-1.974859), FLOAT_C(3.875878), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-1.907120), FLOAT_C(3.112137), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-2.145416), FLOAT_C(2.952912), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-2.825099), FLOAT_C(3.307766), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.075914), FLOAT_C(3.075914), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-2.775482), FLOAT_C(2.370485), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-2.952912), FLOAT_C(2.145416), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.708985), FLOAT_C(2.272869), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.875878), FLOAT_C(1.974859), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.372160), FLOAT_C(1.396795), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.471356), FLOAT_C(1.127912), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-4.229809), FLOAT_C(1.015487), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-4.296444), FLOAT_C(0.680490), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.638748), FLOAT_C(0.286376), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.650000), FLOAT_C(0.000000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-4.336590), FLOAT_C(-0.341297), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-4.296444), FLOAT_C(-0.680490), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.549150), FLOAT_C(-0.852076), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.471356), FLOAT_C(-1.127912), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-4.018876), FLOAT_C(-1.664673), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.875878), FLOAT_C(-1.974859), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.112137), FLOAT_C(-1.907120), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-2.952912), FLOAT_C(-2.145416), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.307766), FLOAT_C(-2.825099), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.075914), FLOAT_C(-3.075914), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-2.370485), FLOAT_C(-2.775482), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-2.145416), FLOAT_C(-2.952912), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-2.272869), FLOAT_C(-3.708985), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-1.974859), FLOAT_C(-3.875878), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-1.396795), FLOAT_C(-3.372160), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-1.127912), FLOAT_C(-3.471356), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-1.015487), FLOAT_C(-4.229809), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.680490), FLOAT_C(-4.296444), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.286376), FLOAT_C(-3.638748), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.000000), FLOAT_C(-3.650000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.341297), FLOAT_C(-4.336590), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.680490), FLOAT_C(-4.296444), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.852076), FLOAT_C(-3.549150), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.127912), FLOAT_C(-3.471356), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.664673), FLOAT_C(-4.018876), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.974859), FLOAT_C(-3.875878), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.907120), FLOAT_C(-3.112137), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(2.145416), FLOAT_C(-2.952912), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(2.825099), FLOAT_C(-3.307766), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.075914), FLOAT_C(-3.075914), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(2.775482), FLOAT_C(-2.370485), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(2.952912), FLOAT_C(-2.145416), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.708985), FLOAT_C(-2.272869), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.875878), FLOAT_C(-1.974859), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.372160), FLOAT_C(-1.396795), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.471356), FLOAT_C(-1.127912), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(4.229809), FLOAT_C(-1.015487), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(4.296444), FLOAT_C(-0.680490), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.638748), FLOAT_C(-0.286376), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.650000), FLOAT_C(-0.000000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(4.336590), FLOAT_C(0.341297), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(4.296444), FLOAT_C(0.680490), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.549150), FLOAT_C(0.852076), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.000000), FLOAT_C(0.000000), FLOAT_C(0.500000), 1 },
+    { FLOAT_C(0.951057), FLOAT_C(0.309017), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.809017), FLOAT_C(0.587785), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.587785), FLOAT_C(0.809017), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.309017), FLOAT_C(0.951057), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(1.000000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.309017), FLOAT_C(0.951057), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.587785), FLOAT_C(0.809017), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.809017), FLOAT_C(0.587785), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.951057), FLOAT_C(0.309017), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-1.000000), FLOAT_C(0.000000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.951057), FLOAT_C(-0.309017), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.809017), FLOAT_C(-0.587785), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.587785), FLOAT_C(-0.809017), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.309017), FLOAT_C(-0.951057), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.000000), FLOAT_C(-1.000000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.309017), FLOAT_C(-0.951057), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.587785), FLOAT_C(-0.809017), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.809017), FLOAT_C(-0.587785), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.951057), FLOAT_C(-0.309017), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.000000), FLOAT_C(-0.000000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.650000), FLOAT_C(0.000000), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(3.650000), FLOAT_C(0.000000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(4.336590), FLOAT_C(0.341297), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(4.336590), FLOAT_C(0.341297), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(4.296444), FLOAT_C(0.680490), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(4.296444), FLOAT_C(0.680490), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.549150), FLOAT_C(0.852076), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(3.549150), FLOAT_C(0.852076), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.000000), FLOAT_C(0.000000), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(1.000000), FLOAT_C(0.000000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.471356), FLOAT_C(1.127912), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(3.471356), FLOAT_C(1.127912), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(4.018876), FLOAT_C(1.664673), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(4.018876), FLOAT_C(1.664673), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.875878), FLOAT_C(1.974859), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(3.875878), FLOAT_C(1.974859), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.112137), FLOAT_C(1.907120), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(3.112137), FLOAT_C(1.907120), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.951057), FLOAT_C(0.309017), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(0.951057), FLOAT_C(0.309017), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(2.952912), FLOAT_C(2.145416), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(2.952912), FLOAT_C(2.145416), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.307766), FLOAT_C(2.825099), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(3.307766), FLOAT_C(2.825099), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.075914), FLOAT_C(3.075914), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(3.075914), FLOAT_C(3.075914), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(2.370485), FLOAT_C(2.775482), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(2.370485), FLOAT_C(2.775482), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.809017), FLOAT_C(0.587785), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(0.809017), FLOAT_C(0.587785), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(2.145416), FLOAT_C(2.952912), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(2.145416), FLOAT_C(2.952912), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(2.272869), FLOAT_C(3.708985), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(2.272869), FLOAT_C(3.708985), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.974859), FLOAT_C(3.875878), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(1.974859), FLOAT_C(3.875878), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.396795), FLOAT_C(3.372160), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(1.396795), FLOAT_C(3.372160), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.587785), FLOAT_C(0.809017), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(0.587785), FLOAT_C(0.809017), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.127912), FLOAT_C(3.471356), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(1.127912), FLOAT_C(3.471356), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.015487), FLOAT_C(4.229809), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(1.015487), FLOAT_C(4.229809), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.680490), FLOAT_C(4.296444), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(0.680490), FLOAT_C(4.296444), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.286376), FLOAT_C(3.638748), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(0.286376), FLOAT_C(3.638748), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.309017), FLOAT_C(0.951057), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(0.309017), FLOAT_C(0.951057), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(3.650000), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(0.000000), FLOAT_C(3.650000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.341297), FLOAT_C(4.336590), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-0.341297), FLOAT_C(4.336590), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.680490), FLOAT_C(4.296444), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-0.680490), FLOAT_C(4.296444), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.852076), FLOAT_C(3.549150), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-0.852076), FLOAT_C(3.549150), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(1.000000), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(0.000000), FLOAT_C(1.000000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-1.127912), FLOAT_C(3.471356), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-1.127912), FLOAT_C(3.471356), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-1.664673), FLOAT_C(4.018876), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-1.664673), FLOAT_C(4.018876), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-1.974859), FLOAT_C(3.875878), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-1.974859), FLOAT_C(3.875878), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-1.907120), FLOAT_C(3.112137), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-1.907120), FLOAT_C(3.112137), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.309017), FLOAT_C(0.951057), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-0.309017), FLOAT_C(0.951057), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-2.145416), FLOAT_C(2.952912), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-2.145416), FLOAT_C(2.952912), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-2.825099), FLOAT_C(3.307766), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-2.825099), FLOAT_C(3.307766), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.075914), FLOAT_C(3.075914), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-3.075914), FLOAT_C(3.075914), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-2.775482), FLOAT_C(2.370485), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-2.775482), FLOAT_C(2.370485), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.587785), FLOAT_C(0.809017), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-0.587785), FLOAT_C(0.809017), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-2.952912), FLOAT_C(2.145416), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-2.952912), FLOAT_C(2.145416), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.708985), FLOAT_C(2.272869), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-3.708985), FLOAT_C(2.272869), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.875878), FLOAT_C(1.974859), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-3.875878), FLOAT_C(1.974859), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.372160), FLOAT_C(1.396795), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-3.372160), FLOAT_C(1.396795), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.809017), FLOAT_C(0.587785), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-0.809017), FLOAT_C(0.587785), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.471356), FLOAT_C(1.127912), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-3.471356), FLOAT_C(1.127912), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-4.229809), FLOAT_C(1.015487), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-4.229809), FLOAT_C(1.015487), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-4.296444), FLOAT_C(0.680490), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-4.296444), FLOAT_C(0.680490), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.638748), FLOAT_C(0.286376), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-3.638748), FLOAT_C(0.286376), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.951057), FLOAT_C(0.309017), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-0.951057), FLOAT_C(0.309017), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.650000), FLOAT_C(0.000000), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-3.650000), FLOAT_C(0.000000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-4.336590), FLOAT_C(-0.341297), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-4.336590), FLOAT_C(-0.341297), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-4.296444), FLOAT_C(-0.680490), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-4.296444), FLOAT_C(-0.680490), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.549150), FLOAT_C(-0.852076), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-3.549150), FLOAT_C(-0.852076), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-1.000000), FLOAT_C(0.000000), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-1.000000), FLOAT_C(0.000000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.471356), FLOAT_C(-1.127912), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-3.471356), FLOAT_C(-1.127912), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-4.018876), FLOAT_C(-1.664673), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-4.018876), FLOAT_C(-1.664673), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.875878), FLOAT_C(-1.974859), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-3.875878), FLOAT_C(-1.974859), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.112137), FLOAT_C(-1.907120), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-3.112137), FLOAT_C(-1.907120), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.951057), FLOAT_C(-0.309017), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-0.951057), FLOAT_C(-0.309017), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-2.952912), FLOAT_C(-2.145416), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-2.952912), FLOAT_C(-2.145416), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.307766), FLOAT_C(-2.825099), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-3.307766), FLOAT_C(-2.825099), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-3.075914), FLOAT_C(-3.075914), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-3.075914), FLOAT_C(-3.075914), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-2.370485), FLOAT_C(-2.775482), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-2.370485), FLOAT_C(-2.775482), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.809017), FLOAT_C(-0.587785), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-0.809017), FLOAT_C(-0.587785), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-2.145416), FLOAT_C(-2.952912), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-2.145416), FLOAT_C(-2.952912), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-2.272869), FLOAT_C(-3.708985), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-2.272869), FLOAT_C(-3.708985), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-1.974859), FLOAT_C(-3.875878), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-1.974859), FLOAT_C(-3.875878), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-1.396795), FLOAT_C(-3.372160), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-1.396795), FLOAT_C(-3.372160), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.587785), FLOAT_C(-0.809017), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-0.587785), FLOAT_C(-0.809017), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-1.127912), FLOAT_C(-3.471356), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-1.127912), FLOAT_C(-3.471356), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-1.015487), FLOAT_C(-4.229809), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-1.015487), FLOAT_C(-4.229809), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.680490), FLOAT_C(-4.296444), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-0.680490), FLOAT_C(-4.296444), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.286376), FLOAT_C(-3.638748), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-0.286376), FLOAT_C(-3.638748), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.309017), FLOAT_C(-0.951057), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-0.309017), FLOAT_C(-0.951057), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.000000), FLOAT_C(-3.650000), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-0.000000), FLOAT_C(-3.650000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.341297), FLOAT_C(-4.336590), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(0.341297), FLOAT_C(-4.336590), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.680490), FLOAT_C(-4.296444), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(0.680490), FLOAT_C(-4.296444), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.852076), FLOAT_C(-3.549150), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(0.852076), FLOAT_C(-3.549150), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(-0.000000), FLOAT_C(-1.000000), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(-0.000000), FLOAT_C(-1.000000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.127912), FLOAT_C(-3.471356), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(1.127912), FLOAT_C(-3.471356), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.664673), FLOAT_C(-4.018876), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(1.664673), FLOAT_C(-4.018876), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.974859), FLOAT_C(-3.875878), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(1.974859), FLOAT_C(-3.875878), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(1.907120), FLOAT_C(-3.112137), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(1.907120), FLOAT_C(-3.112137), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.309017), FLOAT_C(-0.951057), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(0.309017), FLOAT_C(-0.951057), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(2.145416), FLOAT_C(-2.952912), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(2.145416), FLOAT_C(-2.952912), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(2.825099), FLOAT_C(-3.307766), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(2.825099), FLOAT_C(-3.307766), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.075914), FLOAT_C(-3.075914), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(3.075914), FLOAT_C(-3.075914), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(2.775482), FLOAT_C(-2.370485), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(2.775482), FLOAT_C(-2.370485), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.587785), FLOAT_C(-0.809017), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(0.587785), FLOAT_C(-0.809017), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(2.952912), FLOAT_C(-2.145416), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(2.952912), FLOAT_C(-2.145416), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.708985), FLOAT_C(-2.272869), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(3.708985), FLOAT_C(-2.272869), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.875878), FLOAT_C(-1.974859), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(3.875878), FLOAT_C(-1.974859), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.372160), FLOAT_C(-1.396795), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(3.372160), FLOAT_C(-1.396795), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.809017), FLOAT_C(-0.587785), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(0.809017), FLOAT_C(-0.587785), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.471356), FLOAT_C(-1.127912), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(3.471356), FLOAT_C(-1.127912), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(4.229809), FLOAT_C(-1.015487), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(4.229809), FLOAT_C(-1.015487), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(4.296444), FLOAT_C(-0.680490), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(4.296444), FLOAT_C(-0.680490), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.638748), FLOAT_C(-0.286376), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(3.638748), FLOAT_C(-0.286376), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(0.951057), FLOAT_C(-0.309017), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(0.951057), FLOAT_C(-0.309017), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.650000), FLOAT_C(-0.000000), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(3.650000), FLOAT_C(-0.000000), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(4.336590), FLOAT_C(0.341297), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(4.336590), FLOAT_C(0.341297), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(4.296444), FLOAT_C(0.680490), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(4.296444), FLOAT_C(0.680490), FLOAT_C(0.500000), 0 },
+    { FLOAT_C(3.549150), FLOAT_C(0.852076), FLOAT_C(-0.500000), 1 },
+    { FLOAT_C(3.549150), FLOAT_C(0.852076), FLOAT_C(0.500000), 0 },
 };
 // count=418 bytes=5434
 
 
 const point_t glxgear2[] =
 {
-    { 1.650000, 0.000000, -1.000000, 1 },
-    { 2.321068, 0.367621, -1.000000, 0 },
-    { 2.234983, 0.726190, -1.000000, 0 },
-    { 1.470161, 0.749084, -1.000000, 0 },
-    { 1.334878, 0.969846, -1.000000, 0 },
-    { 1.661701, 1.661701, -1.000000, 0 },
-    { 1.381295, 1.901190, -1.000000, 0 },
-    { 0.749084, 1.470161, -1.000000, 0 },
-    { 0.509878, 1.569243, -1.000000, 0 },
-    { 0.367621, 2.321068, -1.000000, 0 },
-    { 0.000000, 2.350000, -1.000000, 0 },
-    { -0.258117, 1.629686, -1.000000, 0 },
-    { -0.509878, 1.569243, -1.000000, 0 },
-    { -1.066878, 2.093865, -1.000000, 0 },
-    { -1.381295, 1.901190, -1.000000, 0 },
-    { -1.166726, 1.166726, -1.000000, 0 },
-    { -1.334878, 0.969846, -1.000000, 0 },
-    { -2.093865, 1.066878, -1.000000, 0 },
-    { -2.234983, 0.726190, -1.000000, 0 },
-    { -1.629686, 0.258117, -1.000000, 0 },
-    { -1.650000, 0.000000, -1.000000, 0 },
-    { -2.321068, -0.367621, -1.000000, 0 },
-    { -2.234983, -0.726190, -1.000000, 0 },
-    { -1.470161, -0.749084, -1.000000, 0 },
-    { -1.334878, -0.969846, -1.000000, 0 },
-    { -1.661701, -1.661701, -1.000000, 0 },
-    { -1.381295, -1.901190, -1.000000, 0 },
-    { -0.749084, -1.470161, -1.000000, 0 },
-    { -0.509878, -1.569243, -1.000000, 0 },
-    { -0.367621, -2.321068, -1.000000, 0 },
-    { -0.000000, -2.350000, -1.000000, 0 },
-    { 0.258117, -1.629686, -1.000000, 0 },
-    { 0.509878, -1.569243, -1.000000, 0 },
-    { 1.066878, -2.093865, -1.000000, 0 },
-    { 1.381295, -1.901190, -1.000000, 0 },
-    { 1.166726, -1.166726, -1.000000, 0 },
-    { 1.334878, -0.969846, -1.000000, 0 },
-    { 2.093865, -1.066878, -1.000000, 0 },
-    { 2.234983, -0.726190, -1.000000, 0 },
-    { 1.629686, -0.258117, -1.000000, 0 },
-    { 1.650000, -0.000000, -1.000000, 0 },
-    { 2.321068, 0.367621, -1.000000, 0 },
-    { 2.234983, 0.726190, -1.000000, 0 },
-    { 1.470161, 0.749084, -1.000000, 0 },
-    { 0.500000, 0.000000, -1.000000, 1 },
-    { 0.404508, 0.293893, -1.000000, 0 },
-    { 0.154508, 0.475528, -1.000000, 0 },
-    { -0.154508, 0.475528, -1.000000, 0 },
-    { -0.404508, 0.293893, -1.000000, 0 },
-    { -0.500000, 0.000000, -1.000000, 0 },
-    { -0.404508, -0.293893, -1.000000, 0 },
-    { -0.154508, -0.475528, -1.000000, 0 },
-    { 0.154508, -0.475528, -1.000000, 0 },
-    { 0.404508, -0.293893, -1.000000, 0 },
-    { 0.500000, -0.000000, -1.000000, 0 },
-    { 1.650000, 0.000000, 1.000000, 1 },
-    { 2.321068, 0.367621, 1.000000, 0 },
-    { 2.234983, 0.726190, 1.000000, 0 },
-    { 1.470161, 0.749084, 1.000000, 0 },
-    { 1.334878, 0.969846, 1.000000, 0 },
-    { 1.661701, 1.661701, 1.000000, 0 },
-    { 1.381295, 1.901190, 1.000000, 0 },
-    { 0.749084, 1.470161, 1.000000, 0 },
-    { 0.509878, 1.569243, 1.000000, 0 },
-    { 0.367621, 2.321068, 1.000000, 0 },
-    { 0.000000, 2.350000, 1.000000, 0 },
-    { -0.258117, 1.629686, 1.000000, 0 },
-    { -0.509878, 1.569243, 1.000000, 0 },
-    { -1.066878, 2.093865, 1.000000, 0 },
-    { -1.381295, 1.901190, 1.000000, 0 },
-    { -1.166726, 1.166726, 1.000000, 0 },
-    { -1.334878, 0.969846, 1.000000, 0 },
-    { -2.093865, 1.066878, 1.000000, 0 },
-    { -2.234983, 0.726190, 1.000000, 0 },
-    { -1.629686, 0.258117, 1.000000, 0 },
-    { -1.650000, 0.000000, 1.000000, 0 },
-    { -2.321068, -0.367621, 1.000000, 0 },
-    { -2.234983, -0.726190, 1.000000, 0 },
-    { -1.470161, -0.749084, 1.000000, 0 },
-    { -1.334878, -0.969846, 1.000000, 0 },
-    { -1.661701, -1.661701, 1.000000, 0 },
-    { -1.381295, -1.901190, 1.000000, 0 },
-    { -0.749084, -1.470161, 1.000000, 0 },
-    { -0.509878, -1.569243, 1.000000, 0 },
-    { -0.367621, -2.321068, 1.000000, 0 },
-    { -0.000000, -2.350000, 1.000000, 0 },
-    { 0.258117, -1.629686, 1.000000, 0 },
-    { 0.509878, -1.569243, 1.000000, 0 },
-    { 1.066878, -2.093865, 1.000000, 0 },
-    { 1.381295, -1.901190, 1.000000, 0 },
-    { 1.166726, -1.166726, 1.000000, 0 },
-    { 1.334878, -0.969846, 1.000000, 0 },
-    { 2.093865, -1.066878, 1.000000, 0 },
-    { 2.234983, -0.726190, 1.000000, 0 },
-    { 1.629686, -0.258117, 1.000000, 0 },
-    { 1.650000, -0.000000, 1.000000, 0 },
-    { 2.321068, 0.367621, 1.000000, 0 },
-    { 2.234983, 0.726190, 1.000000, 0 },
-    { 1.470161, 0.749084, 1.000000, 0 },
-    { 0.500000, 0.000000, 1.000000, 1 },
-    { 0.404508, 0.293893, 1.000000, 0 },
-    { 0.154508, 0.475528, 1.000000, 0 },
-    { -0.154508, 0.475528, 1.000000, 0 },
-    { -0.404508, 0.293893, 1.000000, 0 },
-    { -0.500000, 0.000000, 1.000000, 0 },
-    { -0.404508, -0.293893, 1.000000, 0 },
-    { -0.154508, -0.475528, 1.000000, 0 },
-    { 0.154508, -0.475528, 1.000000, 0 },
-    { 0.404508, -0.293893, 1.000000, 0 },
-    { 0.500000, -0.000000, 1.000000, 0 },
-    { 1.650000, 0.000000, -1.000000, 1 },
-    { 1.650000, 0.000000, 1.000000, 0 },
-    { 2.321068, 0.367621, -1.000000, 1 },
-    { 2.321068, 0.367621, 1.000000, 0 },
-    { 2.234983, 0.726190, -1.000000, 1 },
-    { 2.234983, 0.726190, 1.000000, 0 },
-    { 1.470161, 0.749084, -1.000000, 1 },
-    { 1.470161, 0.749084, 1.000000, 0 },
-    { 0.500000, 0.000000, -1.000000, 1 },
-    { 0.500000, 0.000000, 1.000000, 0 },
-    { 1.334878, 0.969846, -1.000000, 1 },
-    { 1.334878, 0.969846, 1.000000, 0 },
-    { 1.661701, 1.661701, -1.000000, 1 },
-    { 1.661701, 1.661701, 1.000000, 0 },
-    { 1.381295, 1.901190, -1.000000, 1 },
-    { 1.381295, 1.901190, 1.000000, 0 },
-    { 0.749084, 1.470161, -1.000000, 1 },
-    { 0.749084, 1.470161, 1.000000, 0 },
-    { 0.404508, 0.293893, -1.000000, 1 },
-    { 0.404508, 0.293893, 1.000000, 0 },
-    { 0.509878, 1.569243, -1.000000, 1 },
-    { 0.509878, 1.569243, 1.000000, 0 },
-    { 0.367621, 2.321068, -1.000000, 1 },
-    { 0.367621, 2.321068, 1.000000, 0 },
-    { 0.000000, 2.350000, -1.000000, 1 },
-    { 0.000000, 2.350000, 1.000000, 0 },
-    { -0.258117, 1.629686, -1.000000, 1 },
-    { -0.258117, 1.629686, 1.000000, 0 },
-    { 0.154508, 0.475528, -1.000000, 1 },
-    { 0.154508, 0.475528, 1.000000, 0 },
-    { -0.509878, 1.569243, -1.000000, 1 },
-    { -0.509878, 1.569243, 1.000000, 0 },
-    { -1.066878, 2.093865, -1.000000, 1 },
-    { -1.066878, 2.093865, 1.000000, 0 },
-    { -1.381295, 1.901190, -1.000000, 1 },
-    { -1.381295, 1.901190, 1.000000, 0 },
-    { -1.166726, 1.166726, -1.000000, 1 },
-    { -1.166726, 1.166726, 1.000000, 0 },
-    { -0.154508, 0.475528, -1.000000, 1 },
-    { -0.154508, 0.475528, 1.000000, 0 },
-    { -1.334878, 0.969846, -1.000000, 1 },
-    { -1.334878, 0.969846, 1.000000, 0 },
-    { -2.093865, 1.066878, -1.000000, 1 },
-    { -2.093865, 1.066878, 1.000000, 0 },
-    { -2.234983, 0.726190, -1.000000, 1 },
-    { -2.234983, 0.726190, 1.000000, 0 },
-    { -1.629686, 0.258117, -1.000000, 1 },
-    { -1.629686, 0.258117, 1.000000, 0 },
-    { -0.404508, 0.293893, -1.000000, 1 },
-    { -0.404508, 0.293893, 1.000000, 0 },
-    { -1.650000, 0.000000, -1.000000, 1 },
-    { -1.650000, 0.000000, 1.000000, 0 },
-    { -2.321068, -0.367621, -1.000000, 1 },
-    { -2.321068, -0.367621, 1.000000, 0 },
-    { -2.234983, -0.726190, -1.000000, 1 },
-    { -2.234983, -0.726190, 1.000000, 0 },
-    { -1.470161, -0.749084, -1.000000, 1 },
-    { -1.470161, -0.749084, 1.000000, 0 },
-    { -0.500000, 0.000000, -1.000000, 1 },
-    { -0.500000, 0.000000, 1.000000, 0 },
-    { -1.334878, -0.969846, -1.000000, 1 },
-    { -1.334878, -0.969846, 1.000000, 0 },
-    { -1.661701, -1.661701, -1.000000, 1 },
-    { -1.661701, -1.661701, 1.000000, 0 },
-    { -1.381295, -1.901190, -1.000000, 1 },
-    { -1.381295, -1.901190, 1.000000, 0 },
-    { -0.749084, -1.470161, -1.000000, 1 },
-    { -0.749084, -1.470161, 1.000000, 0 },
-    { -0.404508, -0.293893, -1.000000, 1 },
-    { -0.404508, -0.293893, 1.000000, 0 },
-    { -0.509878, -1.569243, -1.000000, 1 },
-    { -0.509878, -1.569243, 1.000000, 0 },
-    { -0.367621, -2.321068, -1.000000, 1 },
-    { -0.367621, -2.321068, 1.000000, 0 },
-    { -0.000000, -2.350000, -1.000000, 1 },
-    { -0.000000, -2.350000, 1.000000, 0 },
-    { 0.258117, -1.629686, -1.000000, 1 },
-    { 0.258117, -1.629686, 1.000000, 0 },
-    { -0.154508, -0.475528, -1.000000, 1 },
-    { -0.154508, -0.475528, 1.000000, 0 },
-    { 0.509878, -1.569243, -1.000000, 1 },
-    { 0.509878, -1.569243, 1.000000, 0 },
-    { 1.066878, -2.093865, -1.000000, 1 },
-    { 1.066878, -2.093865, 1.000000, 0 },
-    { 1.381295, -1.901190, -1.000000, 1 },
-    { 1.381295, -1.901190, 1.000000, 0 },
-    { 1.166726, -1.166726, -1.000000, 1 },
-    { 1.166726, -1.166726, 1.000000, 0 },
-    { 0.154508, -0.475528, -1.000000, 1 },
-    { 0.154508, -0.475528, 1.000000, 0 },
-    { 1.334878, -0.969846, -1.000000, 1 },
-    { 1.334878, -0.969846, 1.000000, 0 },
-    { 2.093865, -1.066878, -1.000000, 1 },
-    { 2.093865, -1.066878, 1.000000, 0 },
-    { 2.234983, -0.726190, -1.000000, 1 },
-    { 2.234983, -0.726190, 1.000000, 0 },
-    { 1.629686, -0.258117, -1.000000, 1 },
-    { 1.629686, -0.258117, 1.000000, 0 },
-    { 0.404508, -0.293893, -1.000000, 1 },
-    { 0.404508, -0.293893, 1.000000, 0 },
-    { 1.650000, -0.000000, -1.000000, 1 },
-    { 1.650000, -0.000000, 1.000000, 0 },
-    { 2.321068, 0.367621, -1.000000, 1 },
-    { 2.321068, 0.367621, 1.000000, 0 },
-    { 2.234983, 0.726190, -1.000000, 1 },
-    { 2.234983, 0.726190, 1.000000, 0 },
-    { 1.470161, 0.749084, -1.000000, 1 },
-    { 1.470161, 0.749084, 1.000000, 0 },
+    { FLOAT_C(1.650000), FLOAT_C(0.000000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(2.321068), FLOAT_C(0.367621), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(2.234983), FLOAT_C(0.726190), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(1.470161), FLOAT_C(0.749084), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(1.334878), FLOAT_C(0.969846), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(1.661701), FLOAT_C(1.661701), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(1.381295), FLOAT_C(1.901190), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(0.749084), FLOAT_C(1.470161), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(0.509878), FLOAT_C(1.569243), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(0.367621), FLOAT_C(2.321068), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(2.350000), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-0.258117), FLOAT_C(1.629686), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-0.509878), FLOAT_C(1.569243), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-1.066878), FLOAT_C(2.093865), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-1.381295), FLOAT_C(1.901190), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-1.166726), FLOAT_C(1.166726), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-1.334878), FLOAT_C(0.969846), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-2.093865), FLOAT_C(1.066878), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-2.234983), FLOAT_C(0.726190), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-1.629686), FLOAT_C(0.258117), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-1.650000), FLOAT_C(0.000000), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-2.321068), FLOAT_C(-0.367621), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-2.234983), FLOAT_C(-0.726190), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-1.470161), FLOAT_C(-0.749084), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-1.334878), FLOAT_C(-0.969846), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-1.661701), FLOAT_C(-1.661701), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-1.381295), FLOAT_C(-1.901190), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-0.749084), FLOAT_C(-1.470161), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-0.509878), FLOAT_C(-1.569243), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-0.367621), FLOAT_C(-2.321068), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-0.000000), FLOAT_C(-2.350000), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(0.258117), FLOAT_C(-1.629686), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(0.509878), FLOAT_C(-1.569243), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(1.066878), FLOAT_C(-2.093865), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(1.381295), FLOAT_C(-1.901190), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(1.166726), FLOAT_C(-1.166726), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(1.334878), FLOAT_C(-0.969846), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(2.093865), FLOAT_C(-1.066878), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(2.234983), FLOAT_C(-0.726190), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(1.629686), FLOAT_C(-0.258117), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(1.650000), FLOAT_C(-0.000000), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(2.321068), FLOAT_C(0.367621), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(2.234983), FLOAT_C(0.726190), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(1.470161), FLOAT_C(0.749084), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(0.500000), FLOAT_C(0.000000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(0.404508), FLOAT_C(0.293893), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(0.154508), FLOAT_C(0.475528), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-0.154508), FLOAT_C(0.475528), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-0.404508), FLOAT_C(0.293893), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-0.500000), FLOAT_C(0.000000), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-0.404508), FLOAT_C(-0.293893), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(-0.154508), FLOAT_C(-0.475528), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(0.154508), FLOAT_C(-0.475528), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(0.404508), FLOAT_C(-0.293893), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(0.500000), FLOAT_C(-0.000000), FLOAT_C(-1.000000), 0 },
+    { FLOAT_C(1.650000), FLOAT_C(0.000000), FLOAT_C(1.000000), 1 },
+    { FLOAT_C(2.321068), FLOAT_C(0.367621), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(2.234983), FLOAT_C(0.726190), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.470161), FLOAT_C(0.749084), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.334878), FLOAT_C(0.969846), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.661701), FLOAT_C(1.661701), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.381295), FLOAT_C(1.901190), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.749084), FLOAT_C(1.470161), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.509878), FLOAT_C(1.569243), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.367621), FLOAT_C(2.321068), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(2.350000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.258117), FLOAT_C(1.629686), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.509878), FLOAT_C(1.569243), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.066878), FLOAT_C(2.093865), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.381295), FLOAT_C(1.901190), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.166726), FLOAT_C(1.166726), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.334878), FLOAT_C(0.969846), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-2.093865), FLOAT_C(1.066878), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-2.234983), FLOAT_C(0.726190), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.629686), FLOAT_C(0.258117), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.650000), FLOAT_C(0.000000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-2.321068), FLOAT_C(-0.367621), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-2.234983), FLOAT_C(-0.726190), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.470161), FLOAT_C(-0.749084), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.334878), FLOAT_C(-0.969846), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.661701), FLOAT_C(-1.661701), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.381295), FLOAT_C(-1.901190), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.749084), FLOAT_C(-1.470161), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.509878), FLOAT_C(-1.569243), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.367621), FLOAT_C(-2.321068), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.000000), FLOAT_C(-2.350000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.258117), FLOAT_C(-1.629686), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.509878), FLOAT_C(-1.569243), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.066878), FLOAT_C(-2.093865), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.381295), FLOAT_C(-1.901190), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.166726), FLOAT_C(-1.166726), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.334878), FLOAT_C(-0.969846), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(2.093865), FLOAT_C(-1.066878), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(2.234983), FLOAT_C(-0.726190), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.629686), FLOAT_C(-0.258117), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.650000), FLOAT_C(-0.000000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(2.321068), FLOAT_C(0.367621), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(2.234983), FLOAT_C(0.726190), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.470161), FLOAT_C(0.749084), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.500000), FLOAT_C(0.000000), FLOAT_C(1.000000), 1 },
+    { FLOAT_C(0.404508), FLOAT_C(0.293893), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.154508), FLOAT_C(0.475528), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.154508), FLOAT_C(0.475528), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.404508), FLOAT_C(0.293893), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.500000), FLOAT_C(0.000000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.404508), FLOAT_C(-0.293893), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.154508), FLOAT_C(-0.475528), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.154508), FLOAT_C(-0.475528), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.404508), FLOAT_C(-0.293893), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.500000), FLOAT_C(-0.000000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.650000), FLOAT_C(0.000000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(1.650000), FLOAT_C(0.000000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(2.321068), FLOAT_C(0.367621), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(2.321068), FLOAT_C(0.367621), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(2.234983), FLOAT_C(0.726190), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(2.234983), FLOAT_C(0.726190), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.470161), FLOAT_C(0.749084), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(1.470161), FLOAT_C(0.749084), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.500000), FLOAT_C(0.000000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(0.500000), FLOAT_C(0.000000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.334878), FLOAT_C(0.969846), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(1.334878), FLOAT_C(0.969846), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.661701), FLOAT_C(1.661701), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(1.661701), FLOAT_C(1.661701), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.381295), FLOAT_C(1.901190), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(1.381295), FLOAT_C(1.901190), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.749084), FLOAT_C(1.470161), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(0.749084), FLOAT_C(1.470161), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.404508), FLOAT_C(0.293893), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(0.404508), FLOAT_C(0.293893), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.509878), FLOAT_C(1.569243), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(0.509878), FLOAT_C(1.569243), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.367621), FLOAT_C(2.321068), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(0.367621), FLOAT_C(2.321068), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(2.350000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(0.000000), FLOAT_C(2.350000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.258117), FLOAT_C(1.629686), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-0.258117), FLOAT_C(1.629686), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.154508), FLOAT_C(0.475528), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(0.154508), FLOAT_C(0.475528), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.509878), FLOAT_C(1.569243), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-0.509878), FLOAT_C(1.569243), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.066878), FLOAT_C(2.093865), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-1.066878), FLOAT_C(2.093865), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.381295), FLOAT_C(1.901190), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-1.381295), FLOAT_C(1.901190), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.166726), FLOAT_C(1.166726), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-1.166726), FLOAT_C(1.166726), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.154508), FLOAT_C(0.475528), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-0.154508), FLOAT_C(0.475528), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.334878), FLOAT_C(0.969846), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-1.334878), FLOAT_C(0.969846), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-2.093865), FLOAT_C(1.066878), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-2.093865), FLOAT_C(1.066878), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-2.234983), FLOAT_C(0.726190), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-2.234983), FLOAT_C(0.726190), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.629686), FLOAT_C(0.258117), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-1.629686), FLOAT_C(0.258117), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.404508), FLOAT_C(0.293893), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-0.404508), FLOAT_C(0.293893), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.650000), FLOAT_C(0.000000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-1.650000), FLOAT_C(0.000000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-2.321068), FLOAT_C(-0.367621), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-2.321068), FLOAT_C(-0.367621), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-2.234983), FLOAT_C(-0.726190), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-2.234983), FLOAT_C(-0.726190), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.470161), FLOAT_C(-0.749084), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-1.470161), FLOAT_C(-0.749084), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.500000), FLOAT_C(0.000000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-0.500000), FLOAT_C(0.000000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.334878), FLOAT_C(-0.969846), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-1.334878), FLOAT_C(-0.969846), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.661701), FLOAT_C(-1.661701), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-1.661701), FLOAT_C(-1.661701), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-1.381295), FLOAT_C(-1.901190), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-1.381295), FLOAT_C(-1.901190), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.749084), FLOAT_C(-1.470161), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-0.749084), FLOAT_C(-1.470161), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.404508), FLOAT_C(-0.293893), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-0.404508), FLOAT_C(-0.293893), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.509878), FLOAT_C(-1.569243), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-0.509878), FLOAT_C(-1.569243), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.367621), FLOAT_C(-2.321068), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-0.367621), FLOAT_C(-2.321068), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.000000), FLOAT_C(-2.350000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-0.000000), FLOAT_C(-2.350000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.258117), FLOAT_C(-1.629686), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(0.258117), FLOAT_C(-1.629686), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(-0.154508), FLOAT_C(-0.475528), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(-0.154508), FLOAT_C(-0.475528), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.509878), FLOAT_C(-1.569243), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(0.509878), FLOAT_C(-1.569243), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.066878), FLOAT_C(-2.093865), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(1.066878), FLOAT_C(-2.093865), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.381295), FLOAT_C(-1.901190), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(1.381295), FLOAT_C(-1.901190), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.166726), FLOAT_C(-1.166726), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(1.166726), FLOAT_C(-1.166726), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.154508), FLOAT_C(-0.475528), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(0.154508), FLOAT_C(-0.475528), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.334878), FLOAT_C(-0.969846), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(1.334878), FLOAT_C(-0.969846), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(2.093865), FLOAT_C(-1.066878), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(2.093865), FLOAT_C(-1.066878), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(2.234983), FLOAT_C(-0.726190), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(2.234983), FLOAT_C(-0.726190), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.629686), FLOAT_C(-0.258117), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(1.629686), FLOAT_C(-0.258117), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(0.404508), FLOAT_C(-0.293893), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(0.404508), FLOAT_C(-0.293893), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.650000), FLOAT_C(-0.000000), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(1.650000), FLOAT_C(-0.000000), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(2.321068), FLOAT_C(0.367621), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(2.321068), FLOAT_C(0.367621), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(2.234983), FLOAT_C(0.726190), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(2.234983), FLOAT_C(0.726190), FLOAT_C(1.000000), 0 },
+    { FLOAT_C(1.470161), FLOAT_C(0.749084), FLOAT_C(-1.000000), 1 },
+    { FLOAT_C(1.470161), FLOAT_C(0.749084), FLOAT_C(1.000000), 0 },
 };
 // count=218 bytes=2834
 
 
 const point_t glxgear3[] =
 {
-    { 1.650000, 0.000000, -0.250000, 1 },
-    { 2.321068, 0.367621, -0.250000, 0 },
-    { 2.234983, 0.726190, -0.250000, 0 },
-    { 1.470161, 0.749084, -0.250000, 0 },
-    { 1.334878, 0.969846, -0.250000, 0 },
-    { 1.661701, 1.661701, -0.250000, 0 },
-    { 1.381295, 1.901190, -0.250000, 0 },
-    { 0.749084, 1.470161, -0.250000, 0 },
-    { 0.509878, 1.569243, -0.250000, 0 },
-    { 0.367621, 2.321068, -0.250000, 0 },
-    { 0.000000, 2.350000, -0.250000, 0 },
-    { -0.258117, 1.629686, -0.250000, 0 },
-    { -0.509878, 1.569243, -0.250000, 0 },
-    { -1.066878, 2.093865, -0.250000, 0 },
-    { -1.381295, 1.901190, -0.250000, 0 },
-    { -1.166726, 1.166726, -0.250000, 0 },
-    { -1.334878, 0.969846, -0.250000, 0 },
-    { -2.093865, 1.066878, -0.250000, 0 },
-    { -2.234983, 0.726190, -0.250000, 0 },
-    { -1.629686, 0.258117, -0.250000, 0 },
-    { -1.650000, 0.000000, -0.250000, 0 },
-    { -2.321068, -0.367621, -0.250000, 0 },
-    { -2.234983, -0.726190, -0.250000, 0 },
-    { -1.470161, -0.749084, -0.250000, 0 },
-    { -1.334878, -0.969846, -0.250000, 0 },
-    { -1.661701, -1.661701, -0.250000, 0 },
-    { -1.381295, -1.901190, -0.250000, 0 },
-    { -0.749084, -1.470161, -0.250000, 0 },
-    { -0.509878, -1.569243, -0.250000, 0 },
-    { -0.367621, -2.321068, -0.250000, 0 },
-    { -0.000000, -2.350000, -0.250000, 0 },
-    { 0.258117, -1.629686, -0.250000, 0 },
-    { 0.509878, -1.569243, -0.250000, 0 },
-    { 1.066878, -2.093865, -0.250000, 0 },
-    { 1.381295, -1.901190, -0.250000, 0 },
-    { 1.166726, -1.166726, -0.250000, 0 },
-    { 1.334878, -0.969846, -0.250000, 0 },
-    { 2.093865, -1.066878, -0.250000, 0 },
-    { 2.234983, -0.726190, -0.250000, 0 },
-    { 1.629686, -0.258117, -0.250000, 0 },
-    { 1.650000, -0.000000, -0.250000, 0 },
-    { 2.321068, 0.367621, -0.250000, 0 },
-    { 2.234983, 0.726190, -0.250000, 0 },
-    { 1.470161, 0.749084, -0.250000, 0 },
-    { 1.300000, 0.000000, -0.250000, 1 },
-    { 1.051722, 0.764121, -0.250000, 0 },
-    { 0.401722, 1.236373, -0.250000, 0 },
-    { -0.401722, 1.236373, -0.250000, 0 },
-    { -1.051722, 0.764121, -0.250000, 0 },
-    { -1.300000, 0.000000, -0.250000, 0 },
-    { -1.051722, -0.764121, -0.250000, 0 },
-    { -0.401722, -1.236373, -0.250000, 0 },
-    { 0.401722, -1.236373, -0.250000, 0 },
-    { 1.051722, -0.764121, -0.250000, 0 },
-    { 1.300000, -0.000000, -0.250000, 0 },
-    { 1.650000, 0.000000, 0.250000, 1 },
-    { 2.321068, 0.367621, 0.250000, 0 },
-    { 2.234983, 0.726190, 0.250000, 0 },
-    { 1.470161, 0.749084, 0.250000, 0 },
-    { 1.334878, 0.969846, 0.250000, 0 },
-    { 1.661701, 1.661701, 0.250000, 0 },
-    { 1.381295, 1.901190, 0.250000, 0 },
-    { 0.749084, 1.470161, 0.250000, 0 },
-    { 0.509878, 1.569243, 0.250000, 0 },
-    { 0.367621, 2.321068, 0.250000, 0 },
-    { 0.000000, 2.350000, 0.250000, 0 },
-    { -0.258117, 1.629686, 0.250000, 0 },
-    { -0.509878, 1.569243, 0.250000, 0 },
-    { -1.066878, 2.093865, 0.250000, 0 },
-    { -1.381295, 1.901190, 0.250000, 0 },
-    { -1.166726, 1.166726, 0.250000, 0 },
-    { -1.334878, 0.969846, 0.250000, 0 },
-    { -2.093865, 1.066878, 0.250000, 0 },
-    { -2.234983, 0.726190, 0.250000, 0 },
-    { -1.629686, 0.258117, 0.250000, 0 },
-    { -1.650000, 0.000000, 0.250000, 0 },
-    { -2.321068, -0.367621, 0.250000, 0 },
-    { -2.234983, -0.726190, 0.250000, 0 },
-    { -1.470161, -0.749084, 0.250000, 0 },
-    { -1.334878, -0.969846, 0.250000, 0 },
-    { -1.661701, -1.661701, 0.250000, 0 },
-    { -1.381295, -1.901190, 0.250000, 0 },
-    { -0.749084, -1.470161, 0.250000, 0 },
-    { -0.509878, -1.569243, 0.250000, 0 },
-    { -0.367621, -2.321068, 0.250000, 0 },
-    { -0.000000, -2.350000, 0.250000, 0 },
-    { 0.258117, -1.629686, 0.250000, 0 },
-    { 0.509878, -1.569243, 0.250000, 0 },
-    { 1.066878, -2.093865, 0.250000, 0 },
-    { 1.381295, -1.901190, 0.250000, 0 },
-    { 1.166726, -1.166726, 0.250000, 0 },
-    { 1.334878, -0.969846, 0.250000, 0 },
-    { 2.093865, -1.066878, 0.250000, 0 },
-    { 2.234983, -0.726190, 0.250000, 0 },
-    { 1.629686, -0.258117, 0.250000, 0 },
-    { 1.650000, -0.000000, 0.250000, 0 },
-    { 2.321068, 0.367621, 0.250000, 0 },
-    { 2.234983, 0.726190, 0.250000, 0 },
-    { 1.470161, 0.749084, 0.250000, 0 },
-    { 1.300000, 0.000000, 0.250000, 1 },
-    { 1.051722, 0.764121, 0.250000, 0 },
-    { 0.401722, 1.236373, 0.250000, 0 },
-    { -0.401722, 1.236373, 0.250000, 0 },
-    { -1.051722, 0.764121, 0.250000, 0 },
-    { -1.300000, 0.000000, 0.250000, 0 },
-    { -1.051722, -0.764121, 0.250000, 0 },
-    { -0.401722, -1.236373, 0.250000, 0 },
-    { 0.401722, -1.236373, 0.250000, 0 },
-    { 1.051722, -0.764121, 0.250000, 0 },
-    { 1.300000, -0.000000, 0.250000, 0 },
-    { 1.650000, 0.000000, -0.250000, 1 },
-    { 1.650000, 0.000000, 0.250000, 0 },
-    { 2.321068, 0.367621, -0.250000, 1 },
-    { 2.321068, 0.367621, 0.250000, 0 },
-    { 2.234983, 0.726190, -0.250000, 1 },
-    { 2.234983, 0.726190, 0.250000, 0 },
-    { 1.470161, 0.749084, -0.250000, 1 },
-    { 1.470161, 0.749084, 0.250000, 0 },
-    { 1.300000, 0.000000, -0.250000, 1 },
-    { 1.300000, 0.000000, 0.250000, 0 },
-    { 1.334878, 0.969846, -0.250000, 1 },
-    { 1.334878, 0.969846, 0.250000, 0 },
-    { 1.661701, 1.661701, -0.250000, 1 },
-    { 1.661701, 1.661701, 0.250000, 0 },
-    { 1.381295, 1.901190, -0.250000, 1 },
-    { 1.381295, 1.901190, 0.250000, 0 },
-    { 0.749084, 1.470161, -0.250000, 1 },
-    { 0.749084, 1.470161, 0.250000, 0 },
-    { 1.051722, 0.764121, -0.250000, 1 },
-    { 1.051722, 0.764121, 0.250000, 0 },
-    { 0.509878, 1.569243, -0.250000, 1 },
-    { 0.509878, 1.569243, 0.250000, 0 },
-    { 0.367621, 2.321068, -0.250000, 1 },
-    { 0.367621, 2.321068, 0.250000, 0 },
-    { 0.000000, 2.350000, -0.250000, 1 },
-    { 0.000000, 2.350000, 0.250000, 0 },
-    { -0.258117, 1.629686, -0.250000, 1 },
-    { -0.258117, 1.629686, 0.250000, 0 },
-    { 0.401722, 1.236373, -0.250000, 1 },
-    { 0.401722, 1.236373, 0.250000, 0 },
-    { -0.509878, 1.569243, -0.250000, 1 },
-    { -0.509878, 1.569243, 0.250000, 0 },
-    { -1.066878, 2.093865, -0.250000, 1 },
-    { -1.066878, 2.093865, 0.250000, 0 },
-    { -1.381295, 1.901190, -0.250000, 1 },
-    { -1.381295, 1.901190, 0.250000, 0 },
-    { -1.166726, 1.166726, -0.250000, 1 },
-    { -1.166726, 1.166726, 0.250000, 0 },
-    { -0.401722, 1.236373, -0.250000, 1 },
-    { -0.401722, 1.236373, 0.250000, 0 },
-    { -1.334878, 0.969846, -0.250000, 1 },
-    { -1.334878, 0.969846, 0.250000, 0 },
-    { -2.093865, 1.066878, -0.250000, 1 },
-    { -2.093865, 1.066878, 0.250000, 0 },
-    { -2.234983, 0.726190, -0.250000, 1 },
-    { -2.234983, 0.726190, 0.250000, 0 },
-    { -1.629686, 0.258117, -0.250000, 1 },
-    { -1.629686, 0.258117, 0.250000, 0 },
-    { -1.051722, 0.764121, -0.250000, 1 },
-    { -1.051722, 0.764121, 0.250000, 0 },
-    { -1.650000, 0.000000, -0.250000, 1 },
-    { -1.650000, 0.000000, 0.250000, 0 },
-    { -2.321068, -0.367621, -0.250000, 1 },
-    { -2.321068, -0.367621, 0.250000, 0 },
-    { -2.234983, -0.726190, -0.250000, 1 },
-    { -2.234983, -0.726190, 0.250000, 0 },
-    { -1.470161, -0.749084, -0.250000, 1 },
-    { -1.470161, -0.749084, 0.250000, 0 },
-    { -1.300000, 0.000000, -0.250000, 1 },
-    { -1.300000, 0.000000, 0.250000, 0 },
-    { -1.334878, -0.969846, -0.250000, 1 },
-    { -1.334878, -0.969846, 0.250000, 0 },
-    { -1.661701, -1.661701, -0.250000, 1 },
-    { -1.661701, -1.661701, 0.250000, 0 },
-    { -1.381295, -1.901190, -0.250000, 1 },
-    { -1.381295, -1.901190, 0.250000, 0 },
-    { -0.749084, -1.470161, -0.250000, 1 },
-    { -0.749084, -1.470161, 0.250000, 0 },
-    { -1.051722, -0.764121, -0.250000, 1 },
-    { -1.051722, -0.764121, 0.250000, 0 },
-    { -0.509878, -1.569243, -0.250000, 1 },
-    { -0.509878, -1.569243, 0.250000, 0 },
-    { -0.367621, -2.321068, -0.250000, 1 },
-    { -0.367621, -2.321068, 0.250000, 0 },
-    { -0.000000, -2.350000, -0.250000, 1 },
-    { -0.000000, -2.350000, 0.250000, 0 },
-    { 0.258117, -1.629686, -0.250000, 1 },
-    { 0.258117, -1.629686, 0.250000, 0 },
-    { -0.401722, -1.236373, -0.250000, 1 },
-    { -0.401722, -1.236373, 0.250000, 0 },
-    { 0.509878, -1.569243, -0.250000, 1 },
-    { 0.509878, -1.569243, 0.250000, 0 },
-    { 1.066878, -2.093865, -0.250000, 1 },
-    { 1.066878, -2.093865, 0.250000, 0 },
-    { 1.381295, -1.901190, -0.250000, 1 },
-    { 1.381295, -1.901190, 0.250000, 0 },
-    { 1.166726, -1.166726, -0.250000, 1 },
-    { 1.166726, -1.166726, 0.250000, 0 },
-    { 0.401722, -1.236373, -0.250000, 1 },
-    { 0.401722, -1.236373, 0.250000, 0 },
-    { 1.334878, -0.969846, -0.250000, 1 },
-    { 1.334878, -0.969846, 0.250000, 0 },
-    { 2.093865, -1.066878, -0.250000, 1 },
-    { 2.093865, -1.066878, 0.250000, 0 },
-    { 2.234983, -0.726190, -0.250000, 1 },
-    { 2.234983, -0.726190, 0.250000, 0 },
-    { 1.629686, -0.258117, -0.250000, 1 },
-    { 1.629686, -0.258117, 0.250000, 0 },
-    { 1.051722, -0.764121, -0.250000, 1 },
-    { 1.051722, -0.764121, 0.250000, 0 },
-    { 1.650000, -0.000000, -0.250000, 1 },
-    { 1.650000, -0.000000, 0.250000, 0 },
-    { 2.321068, 0.367621, -0.250000, 1 },
-    { 2.321068, 0.367621, 0.250000, 0 },
-    { 2.234983, 0.726190, -0.250000, 1 },
-    { 2.234983, 0.726190, 0.250000, 0 },
-    { 1.470161, 0.749084, -0.250000, 1 },
-    { 1.470161, 0.749084, 0.250000, 0 },
+    { FLOAT_C(1.650000), FLOAT_C(0.000000), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(2.321068), FLOAT_C(0.367621), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(2.234983), FLOAT_C(0.726190), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.470161), FLOAT_C(0.749084), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.334878), FLOAT_C(0.969846), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.661701), FLOAT_C(1.661701), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.381295), FLOAT_C(1.901190), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.749084), FLOAT_C(1.470161), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.509878), FLOAT_C(1.569243), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.367621), FLOAT_C(2.321068), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(2.350000), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.258117), FLOAT_C(1.629686), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.509878), FLOAT_C(1.569243), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-1.066878), FLOAT_C(2.093865), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-1.381295), FLOAT_C(1.901190), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-1.166726), FLOAT_C(1.166726), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-1.334878), FLOAT_C(0.969846), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-2.093865), FLOAT_C(1.066878), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-2.234983), FLOAT_C(0.726190), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-1.629686), FLOAT_C(0.258117), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-1.650000), FLOAT_C(0.000000), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-2.321068), FLOAT_C(-0.367621), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-2.234983), FLOAT_C(-0.726190), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-1.470161), FLOAT_C(-0.749084), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-1.334878), FLOAT_C(-0.969846), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-1.661701), FLOAT_C(-1.661701), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-1.381295), FLOAT_C(-1.901190), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.749084), FLOAT_C(-1.470161), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.509878), FLOAT_C(-1.569243), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.367621), FLOAT_C(-2.321068), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.000000), FLOAT_C(-2.350000), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.258117), FLOAT_C(-1.629686), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.509878), FLOAT_C(-1.569243), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.066878), FLOAT_C(-2.093865), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.381295), FLOAT_C(-1.901190), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.166726), FLOAT_C(-1.166726), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.334878), FLOAT_C(-0.969846), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(2.093865), FLOAT_C(-1.066878), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(2.234983), FLOAT_C(-0.726190), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.629686), FLOAT_C(-0.258117), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.650000), FLOAT_C(-0.000000), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(2.321068), FLOAT_C(0.367621), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(2.234983), FLOAT_C(0.726190), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.470161), FLOAT_C(0.749084), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.300000), FLOAT_C(0.000000), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.051722), FLOAT_C(0.764121), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.401722), FLOAT_C(1.236373), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.401722), FLOAT_C(1.236373), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-1.051722), FLOAT_C(0.764121), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-1.300000), FLOAT_C(0.000000), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-1.051722), FLOAT_C(-0.764121), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(-0.401722), FLOAT_C(-1.236373), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(0.401722), FLOAT_C(-1.236373), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.051722), FLOAT_C(-0.764121), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.300000), FLOAT_C(-0.000000), FLOAT_C(-0.250000), 0 },
+    { FLOAT_C(1.650000), FLOAT_C(0.000000), FLOAT_C(0.250000), 1 },
+    { FLOAT_C(2.321068), FLOAT_C(0.367621), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(2.234983), FLOAT_C(0.726190), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.470161), FLOAT_C(0.749084), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.334878), FLOAT_C(0.969846), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.661701), FLOAT_C(1.661701), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.381295), FLOAT_C(1.901190), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.749084), FLOAT_C(1.470161), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.509878), FLOAT_C(1.569243), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.367621), FLOAT_C(2.321068), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(2.350000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.258117), FLOAT_C(1.629686), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.509878), FLOAT_C(1.569243), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.066878), FLOAT_C(2.093865), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.381295), FLOAT_C(1.901190), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.166726), FLOAT_C(1.166726), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.334878), FLOAT_C(0.969846), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-2.093865), FLOAT_C(1.066878), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-2.234983), FLOAT_C(0.726190), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.629686), FLOAT_C(0.258117), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.650000), FLOAT_C(0.000000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-2.321068), FLOAT_C(-0.367621), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-2.234983), FLOAT_C(-0.726190), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.470161), FLOAT_C(-0.749084), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.334878), FLOAT_C(-0.969846), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.661701), FLOAT_C(-1.661701), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.381295), FLOAT_C(-1.901190), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.749084), FLOAT_C(-1.470161), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.509878), FLOAT_C(-1.569243), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.367621), FLOAT_C(-2.321068), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.000000), FLOAT_C(-2.350000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.258117), FLOAT_C(-1.629686), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.509878), FLOAT_C(-1.569243), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.066878), FLOAT_C(-2.093865), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.381295), FLOAT_C(-1.901190), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.166726), FLOAT_C(-1.166726), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.334878), FLOAT_C(-0.969846), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(2.093865), FLOAT_C(-1.066878), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(2.234983), FLOAT_C(-0.726190), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.629686), FLOAT_C(-0.258117), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.650000), FLOAT_C(-0.000000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(2.321068), FLOAT_C(0.367621), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(2.234983), FLOAT_C(0.726190), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.470161), FLOAT_C(0.749084), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.300000), FLOAT_C(0.000000), FLOAT_C(0.250000), 1 },
+    { FLOAT_C(1.051722), FLOAT_C(0.764121), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.401722), FLOAT_C(1.236373), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.401722), FLOAT_C(1.236373), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.051722), FLOAT_C(0.764121), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.300000), FLOAT_C(0.000000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.051722), FLOAT_C(-0.764121), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.401722), FLOAT_C(-1.236373), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.401722), FLOAT_C(-1.236373), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.051722), FLOAT_C(-0.764121), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.300000), FLOAT_C(-0.000000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.650000), FLOAT_C(0.000000), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.650000), FLOAT_C(0.000000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(2.321068), FLOAT_C(0.367621), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(2.321068), FLOAT_C(0.367621), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(2.234983), FLOAT_C(0.726190), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(2.234983), FLOAT_C(0.726190), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.470161), FLOAT_C(0.749084), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.470161), FLOAT_C(0.749084), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.300000), FLOAT_C(0.000000), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.300000), FLOAT_C(0.000000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.334878), FLOAT_C(0.969846), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.334878), FLOAT_C(0.969846), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.661701), FLOAT_C(1.661701), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.661701), FLOAT_C(1.661701), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.381295), FLOAT_C(1.901190), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.381295), FLOAT_C(1.901190), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.749084), FLOAT_C(1.470161), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.749084), FLOAT_C(1.470161), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.051722), FLOAT_C(0.764121), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.051722), FLOAT_C(0.764121), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.509878), FLOAT_C(1.569243), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.509878), FLOAT_C(1.569243), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.367621), FLOAT_C(2.321068), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.367621), FLOAT_C(2.321068), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.000000), FLOAT_C(2.350000), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.000000), FLOAT_C(2.350000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.258117), FLOAT_C(1.629686), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.258117), FLOAT_C(1.629686), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.401722), FLOAT_C(1.236373), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.401722), FLOAT_C(1.236373), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.509878), FLOAT_C(1.569243), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.509878), FLOAT_C(1.569243), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.066878), FLOAT_C(2.093865), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-1.066878), FLOAT_C(2.093865), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.381295), FLOAT_C(1.901190), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-1.381295), FLOAT_C(1.901190), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.166726), FLOAT_C(1.166726), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-1.166726), FLOAT_C(1.166726), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.401722), FLOAT_C(1.236373), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.401722), FLOAT_C(1.236373), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.334878), FLOAT_C(0.969846), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-1.334878), FLOAT_C(0.969846), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-2.093865), FLOAT_C(1.066878), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-2.093865), FLOAT_C(1.066878), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-2.234983), FLOAT_C(0.726190), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-2.234983), FLOAT_C(0.726190), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.629686), FLOAT_C(0.258117), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-1.629686), FLOAT_C(0.258117), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.051722), FLOAT_C(0.764121), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-1.051722), FLOAT_C(0.764121), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.650000), FLOAT_C(0.000000), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-1.650000), FLOAT_C(0.000000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-2.321068), FLOAT_C(-0.367621), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-2.321068), FLOAT_C(-0.367621), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-2.234983), FLOAT_C(-0.726190), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-2.234983), FLOAT_C(-0.726190), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.470161), FLOAT_C(-0.749084), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-1.470161), FLOAT_C(-0.749084), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.300000), FLOAT_C(0.000000), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-1.300000), FLOAT_C(0.000000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.334878), FLOAT_C(-0.969846), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-1.334878), FLOAT_C(-0.969846), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.661701), FLOAT_C(-1.661701), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-1.661701), FLOAT_C(-1.661701), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.381295), FLOAT_C(-1.901190), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-1.381295), FLOAT_C(-1.901190), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.749084), FLOAT_C(-1.470161), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.749084), FLOAT_C(-1.470161), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-1.051722), FLOAT_C(-0.764121), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-1.051722), FLOAT_C(-0.764121), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.509878), FLOAT_C(-1.569243), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.509878), FLOAT_C(-1.569243), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.367621), FLOAT_C(-2.321068), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.367621), FLOAT_C(-2.321068), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.000000), FLOAT_C(-2.350000), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.000000), FLOAT_C(-2.350000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.258117), FLOAT_C(-1.629686), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.258117), FLOAT_C(-1.629686), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(-0.401722), FLOAT_C(-1.236373), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(-0.401722), FLOAT_C(-1.236373), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.509878), FLOAT_C(-1.569243), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.509878), FLOAT_C(-1.569243), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.066878), FLOAT_C(-2.093865), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.066878), FLOAT_C(-2.093865), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.381295), FLOAT_C(-1.901190), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.381295), FLOAT_C(-1.901190), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.166726), FLOAT_C(-1.166726), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.166726), FLOAT_C(-1.166726), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(0.401722), FLOAT_C(-1.236373), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(0.401722), FLOAT_C(-1.236373), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.334878), FLOAT_C(-0.969846), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.334878), FLOAT_C(-0.969846), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(2.093865), FLOAT_C(-1.066878), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(2.093865), FLOAT_C(-1.066878), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(2.234983), FLOAT_C(-0.726190), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(2.234983), FLOAT_C(-0.726190), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.629686), FLOAT_C(-0.258117), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.629686), FLOAT_C(-0.258117), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.051722), FLOAT_C(-0.764121), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.051722), FLOAT_C(-0.764121), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.650000), FLOAT_C(-0.000000), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.650000), FLOAT_C(-0.000000), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(2.321068), FLOAT_C(0.367621), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(2.321068), FLOAT_C(0.367621), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(2.234983), FLOAT_C(0.726190), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(2.234983), FLOAT_C(0.726190), FLOAT_C(0.250000), 0 },
+    { FLOAT_C(1.470161), FLOAT_C(0.749084), FLOAT_C(-0.250000), 1 },
+    { FLOAT_C(1.470161), FLOAT_C(0.749084), FLOAT_C(0.250000), 0 },
 };
 // count=218 bytes=2834
 
@@ -0,0 +1,912 @@
+// packed models, generated from models.h by pack_models.c
+
+#ifndef _MODELS_PACKED_H
+#define _MODELS_PACKED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+const int8_t cube_vertices[] =
+{
+    -64, -64, -64,
+    64, -64, -64,
+    64, 64, -64,
+    -64, 64, -64,
+    -64, -64, 64,
+    64, -64, 64,
+    64, 64, 64,
+    -64, 64, 64,
+};
+
+const uint16_t cube_indices[] =
+{
+    MESH_MOVE|0, 1, 2, 3, 0,
+    MESH_MOVE|4, 5, 6, 7, 4,
+    MESH_MOVE|0, 4,
+    MESH_MOVE|1, 5,
+    MESH_MOVE|2, 6,
+    MESH_MOVE|3, 7,
+};
+
+const model_t cube_model = { cube_vertices, cube_indices, 8, 18, FLOAT_C(1.0/64), 0 };
+// vertices=8 indices=18 bytes=60, was bytes=234 as point_t with 32 bit FLOAT
+
+
+const int8_t icos_vertices[] =
+{
+    0, 0, 64,
+    55, 0, 32,
+    0, 0, -64,
+    45, 33, -32,
+    17, 53, 32,
+    -17, 53, -32,
+    -45, 33, 32,
+    -55, 0, -32,
+    -45, -33, 32,
+    -17, -53, -32,
+    17, -53, 32,
+    45, -33, -32,
+};
+
+const uint16_t icos_indices[] =
+{
+    MESH_MOVE|0, 1,
+    MESH_MOVE|2, 3,
+    MESH_MOVE|0, 4,
+    MESH_MOVE|2, 5,
+    MESH_MOVE|0, 6,
+    MESH_MOVE|2, 7,
+    MESH_MOVE|0, 8,
+    MESH_MOVE|2, 9,
+    MESH_MOVE|0, 10,
+    MESH_MOVE|2, 11,
+    MESH_MOVE|0, 1,
+    MESH_MOVE|2, 3,
+    MESH_MOVE|1, 4, 6, 8, 10, 1, 4,
+    MESH_MOVE|3, 5, 7, 9, 11, 3, 5,
+    MESH_MOVE|1, 3, 4, 5, 6, 7, 8, 9, 10, 11, 1, 3, 4,
+};
+
+const model_t icos_model = { icos_vertices, icos_indices, 12, 51, FLOAT_C(1.0/64), 0 };
+// vertices=12 indices=51 bytes=138, was bytes=663 as point_t with 32 bit FLOAT
+
+
+const int8_t gear_vertices[] =
+{
+    64, 2, -16,
+    62, 15, -16,
+    73, 22, -16,
+    68, 36, -16,
+    54, 34, -16,
+    47, 44, -16,
+    52, 56, -16,
+    41, 65, -16,
+    30, 56, -16,
+    19, 61, -16,
+    17, 75, -16,
+    3, 77, -16,
+    -2, 64, -16,
+    -15, 62, -16,
+    -22, 73, -16,
+    -36, 68, -16,
+    -34, 54, -16,
+    -44, 47, -16,
+    -56, 52, -16,
+    -65, 41, -16,
+    -56, 30, -16,
+    -61, 19, -16,
+    -75, 17, -16,
+    -77, 3, -16,
+    -64, -2, -16,
+    -62, -15, -16,
+    -73, -22, -16,
+    -68, -36, -16,
+    -54, -34, -16,
+    -47, -44, -16,
+    -52, -56, -16,
+    -41, -65, -16,
+    -30, -56, -16,
+    -19, -61, -16,
+    -17, -75, -16,
+    -3, -77, -16,
+    2, -64, -16,
+    15, -62, -16,
+    22, -73, -16,
+    36, -68, -16,
+    34, -54, -16,
+    44, -47, -16,
+    56, -52, -16,
+    65, -41, -16,
+    56, -30, -16,
+    61, -19, -16,
+    75, -17, -16,
+    77, -3, -16,
+    64, 2, 16,
+    62, 15, 16,
+    73, 22, 16,
+    68, 36, 16,
+    54, 34, 16,
+    47, 44, 16,
+    52, 56, 16,
+    41, 65, 16,
+    30, 56, 16,
+    19, 61, 16,
+    17, 75, 16,
+    3, 77, 16,
+    -2, 64, 16,
+    -15, 62, 16,
+    -22, 73, 16,
+    -36, 68, 16,
+    -34, 54, 16,
+    -44, 47, 16,
+    -56, 52, 16,
+    -65, 41, 16,
+    -56, 30, 16,
+    -61, 19, 16,
+    -75, 17, 16,
+    -77, 3, 16,
+    -64, -2, 16,
+    -62, -15, 16,
+    -73, -22, 16,
+    -68, -36, 16,
+    -54, -34, 16,
+    -47, -44, 16,
+    -52, -56, 16,
+    -41, -65, 16,
+    -30, -56, 16,
+    -19, -61, 16,
+    -17, -75, 16,
+    -3, -77, 16,
+    2, -64, 16,
+    15, -62, 16,
+    22, -73, 16,
+    36, -68, 16,
+    34, -54, 16,
+    44, -47, 16,
+    56, -52, 16,
+    65, -41, 16,
+    56, -30, 16,
+    61, -19, 16,
+    75, -17, 16,
+    77, -3, 16,
+    -6, -6, -16,
+    6, -6, -16,
+    6, 6, -16,
+    -6, 6, -16,
+    -6, -6, 16,
+    6, -6, 16,
+    6, 6, 16,
+    -6, 6, 16,
+};
+
+const uint16_t gear_indices[] =
+{
+    MESH_MOVE|0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 0,
+    MESH_MOVE|48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 48,
+    MESH_MOVE|0, 48,
+    MESH_MOVE|47, 95,
+    MESH_MOVE|1, 49,
+    MESH_MOVE|2, 50,
+    MESH_MOVE|4, 52,
+    MESH_MOVE|3, 51,
+    MESH_MOVE|5, 53,
+    MESH_MOVE|6, 54,
+    MESH_MOVE|8, 56,
+    MESH_MOVE|7, 55,
+    MESH_MOVE|9, 57,
+    MESH_MOVE|10, 58,
+    MESH_MOVE|12, 60,
+    MESH_MOVE|11, 59,
+    MESH_MOVE|13, 61,
+    MESH_MOVE|14, 62,
+    MESH_MOVE|16, 64,
+    MESH_MOVE|15, 63,
+    MESH_MOVE|17, 65,
+    MESH_MOVE|18, 66,
+    MESH_MOVE|20, 68,
+    MESH_MOVE|19, 67,
+    MESH_MOVE|21, 69,
+    MESH_MOVE|22, 70,
+    MESH_MOVE|24, 72,
+    MESH_MOVE|23, 71,
+    MESH_MOVE|25, 73,
+    MESH_MOVE|26, 74,
+    MESH_MOVE|28, 76,
+    MESH_MOVE|27, 75,
+    MESH_MOVE|29, 77,
+    MESH_MOVE|30, 78,
+    MESH_MOVE|32, 80,
+    MESH_MOVE|31, 79,
+    MESH_MOVE|33, 81,
+    MESH_MOVE|34, 82,
+    MESH_MOVE|36, 84,
+    MESH_MOVE|35, 83,
+    MESH_MOVE|37, 85,
+    MESH_MOVE|38, 86,
+    MESH_MOVE|40, 88,
+    MESH_MOVE|39, 87,
+    MESH_MOVE|41, 89,
+    MESH_MOVE|42, 90,
+    MESH_MOVE|44, 92,
+    MESH_MOVE|43, 91,
+    MESH_MOVE|45, 93,
+    MESH_MOVE|46, 94,
+    MESH_MOVE|96, 97, 98, 99, 96,
+    MESH_MOVE|100, 101, 102, 103, 100,
+    MESH_MOVE|96, 100,
+    MESH_MOVE|97, 101,
+    MESH_MOVE|98, 102,
+    MESH_MOVE|99, 103,
+};
+
+const model_t gear_model = { gear_vertices, gear_indices, 104, 212, FLOAT_C(1.0/64), 0 };
+// vertices=104 indices=212 bytes=736, was bytes=2756 as point_t with 32 bit FLOAT
+
+
+const int8_t glxgear1_vertices[] =
+{
+    58, 0, -8,
+    69, 5, -8,
+    69, 11, -8,
+    57, 14, -8,
+    56, 18, -8,
+    64, 27, -8,
+    62, 32, -8,
+    50, 31, -8,
+    47, 34, -8,
+    53, 45, -8,
+    49, 49, -8,
+    38, 44, -8,
+    34, 47, -8,
+    36, 59, -8,
+    32, 62, -8,
+    22, 54, -8,
+    18, 56, -8,
+    16, 68, -8,
+    11, 69, -8,
+    5, 58, -8,
+    0, 58, -8,
+    -5, 69, -8,
+    -11, 69, -8,
+    -14, 57, -8,
+    -18, 56, -8,
+    -27, 64, -8,
+    -32, 62, -8,
+    -31, 50, -8,
+    -34, 47, -8,
+    -45, 53, -8,
+    -49, 49, -8,
+    -44, 38, -8,
+    -47, 34, -8,
+    -59, 36, -8,
+    -62, 32, -8,
+    -54, 22, -8,
+    -56, 18, -8,
+    -68, 16, -8,
+    -69, 11, -8,
+    -58, 5, -8,
+    -58, 0, -8,
+    -69, -5, -8,
+    -69, -11, -8,
+    -57, -14, -8,
+    -56, -18, -8,
+    -64, -27, -8,
+    -62, -32, -8,
+    -50, -31, -8,
+    -47, -34, -8,
+    -53, -45, -8,
+    -49, -49, -8,
+    -38, -44, -8,
+    -34, -47, -8,
+    -36, -59, -8,
+    -32, -62, -8,
+    -22, -54, -8,
+    -18, -56, -8,
+    -16, -68, -8,
+    -11, -69, -8,
+    -5, -58, -8,
+    0, -58, -8,
+    5, -69, -8,
+    11, -69, -8,
+    14, -57, -8,
+    18, -56, -8,
+    27, -64, -8,
+    32, -62, -8,
+    31, -50, -8,
+    34, -47, -8,
+    45, -53, -8,
+    49, -49, -8,
+    44, -38, -8,
+    47, -34, -8,
+    59, -36, -8,
+    62, -32, -8,
+    54, -22, -8,
+    56, -18, -8,
+    68, -16, -8,
+    69, -11, -8,
+    58, -5, -8,
+    16, 0, -8,
+    15, 5, -8,
+    13, 9, -8,
+    9, 13, -8,
+    5, 15, -8,
+    0, 16, -8,
+    -5, 15, -8,
+    -9, 13, -8,
+    -13, 9, -8,
+    -15, 5, -8,
+    -16, 0, -8,
+    -15, -5, -8,
+    -13, -9, -8,
+    -9, -13, -8,
+    -5, -15, -8,
+    0, -16, -8,
+    5, -15, -8,
+    9, -13, -8,
+    13, -9, -8,
+    15, -5, -8,
+    58, 0, 8,
+    69, 5, 8,
+    69, 11, 8,
+    57, 14, 8,
+    56, 18, 8,
+    64, 27, 8,
+    62, 32, 8,
+    50, 31, 8,
+    47, 34, 8,
+    53, 45, 8,
+    49, 49, 8,
+    38, 44, 8,
+    34, 47, 8,
+    36, 59, 8,
+    32, 62, 8,
+    22, 54, 8,
+    18, 56, 8,
+    16, 68, 8,
+    11, 69, 8,
+    5, 58, 8,
+    0, 58, 8,
+    -5, 69, 8,
+    -11, 69, 8,
+    -14, 57, 8,
+    -18, 56, 8,
+    -27, 64, 8,
+    -32, 62, 8,
+    -31, 50, 8,
+    -34, 47, 8,
+    -45, 53, 8,
+    -49, 49, 8,
+    -44, 38, 8,
+    -47, 34, 8,
+    -59, 36, 8,
+    -62, 32, 8,
+    -54, 22, 8,
+    -56, 18, 8,
+    -68, 16, 8,
+    -69, 11, 8,
+    -58, 5, 8,
+    -58, 0, 8,
+    -69, -5, 8,
+    -69, -11, 8,
+    -57, -14, 8,
+    -56, -18, 8,
+    -64, -27, 8,
+    -62, -32, 8,
+    -50, -31, 8,
+    -47, -34, 8,
+    -53, -45, 8,
+    -49, -49, 8,
+    -38, -44, 8,
+    -34, -47, 8,
+    -36, -59, 8,
+    -32, -62, 8,
+    -22, -54, 8,
+    -18, -56, 8,
+    -16, -68, 8,
+    -11, -69, 8,
+    -5, -58, 8,
+    0, -58, 8,
+    5, -69, 8,
+    11, -69, 8,
+    14, -57, 8,
+    18, -56, 8,
+    27, -64, 8,
+    32, -62, 8,
+    31, -50, 8,
+    34, -47, 8,
+    45, -53, 8,
+    49, -49, 8,
+    44, -38, 8,
+    47, -34, 8,
+    59, -36, 8,
+    62, -32, 8,
+    54, -22, 8,
+    56, -18, 8,
+    68, -16, 8,
+    69, -11, 8,
+    58, -5, 8,
+    16, 0, 8,
+    15, 5, 8,
+    13, 9, 8,
+    9, 13, 8,
+    5, 15, 8,
+    0, 16, 8,
+    -5, 15, 8,
+    -9, 13, 8,
+    -13, 9, 8,
+    -15, 5, 8,
+    -16, 0, 8,
+    -15, -5, 8,
+    -13, -9, 8,
+    -9, -13, 8,
+    -5, -15, 8,
+    0, -16, 8,
+    5, -15, 8,
+    9, -13, 8,
+    13, -9, 8,
+    15, -5, 8,
+};
+
+const uint16_t glxgear1_indices[] =
+{
+    MESH_MOVE|0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 0, 1, 2, 3,
+    MESH_MOVE|80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 80,
+    MESH_MOVE|100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 100, 101, 102, 103,
+    MESH_MOVE|180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 180,
+    MESH_MOVE|0, 100,
+    MESH_MOVE|1, 101,
+    MESH_MOVE|2, 102,
+    MESH_MOVE|3, 103,
+    MESH_MOVE|80, 180,
+    MESH_MOVE|4, 104,
+    MESH_MOVE|5, 105,
+    MESH_MOVE|6, 106,
+    MESH_MOVE|7, 107,
+    MESH_MOVE|81, 181,
+    MESH_MOVE|8, 108,
+    MESH_MOVE|9, 109,
+    MESH_MOVE|10, 110,
+    MESH_MOVE|11, 111,
+    MESH_MOVE|82, 182,
+    MESH_MOVE|12, 112,
+    MESH_MOVE|13, 113,
+    MESH_MOVE|14, 114,
+    MESH_MOVE|15, 115,
+    MESH_MOVE|83, 183,
+    MESH_MOVE|16, 116,
+    MESH_MOVE|17, 117,
+    MESH_MOVE|18, 118,
+    MESH_MOVE|19, 119,
+    MESH_MOVE|84, 184,
+    MESH_MOVE|20, 120,
+    MESH_MOVE|21, 121,
+    MESH_MOVE|22, 122,
+    MESH_MOVE|23, 123,
+    MESH_MOVE|85, 185,
+    MESH_MOVE|24, 124,
+    MESH_MOVE|25, 125,
+    MESH_MOVE|26, 126,
+    MESH_MOVE|27, 127,
+    MESH_MOVE|86, 186,
+    MESH_MOVE|28, 128,
+    MESH_MOVE|29, 129,
+    MESH_MOVE|30, 130,
+    MESH_MOVE|31, 131,
+    MESH_MOVE|87, 187,
+    MESH_MOVE|32, 132,
+    MESH_MOVE|33, 133,
+    MESH_MOVE|34, 134,
+    MESH_MOVE|35, 135,
+    MESH_MOVE|88, 188,
+    MESH_MOVE|36, 136,
+    MESH_MOVE|37, 137,
+    MESH_MOVE|38, 138,
+    MESH_MOVE|39, 139,
+    MESH_MOVE|89, 189,
+    MESH_MOVE|40, 140,
+    MESH_MOVE|41, 141,
+    MESH_MOVE|42, 142,
+    MESH_MOVE|43, 143,
+    MESH_MOVE|90, 190,
+    MESH_MOVE|44, 144,
+    MESH_MOVE|45, 145,
+    MESH_MOVE|46, 146,
+    MESH_MOVE|47, 147,
+    MESH_MOVE|91, 191,
+    MESH_MOVE|48, 148,
+    MESH_MOVE|49, 149,
+    MESH_MOVE|50, 150,
+    MESH_MOVE|51, 151,
+    MESH_MOVE|92, 192,
+    MESH_MOVE|52, 152,
+    MESH_MOVE|53, 153,
+    MESH_MOVE|54, 154,
+    MESH_MOVE|55, 155,
+    MESH_MOVE|93, 193,
+    MESH_MOVE|56, 156,
+    MESH_MOVE|57, 157,
+    MESH_MOVE|58, 158,
+    MESH_MOVE|59, 159,
+    MESH_MOVE|94, 194,
+    MESH_MOVE|60, 160,
+    MESH_MOVE|61, 161,
+    MESH_MOVE|62, 162,
+    MESH_MOVE|63, 163,
+    MESH_MOVE|95, 195,
+    MESH_MOVE|64, 164,
+    MESH_MOVE|65, 165,
+    MESH_MOVE|66, 166,
+    MESH_MOVE|67, 167,
+    MESH_MOVE|96, 196,
+    MESH_MOVE|68, 168,
+    MESH_MOVE|69, 169,
+    MESH_MOVE|70, 170,
+    MESH_MOVE|71, 171,
+    MESH_MOVE|97, 197,
+    MESH_MOVE|72, 172,
+    MESH_MOVE|73, 173,
+    MESH_MOVE|74, 174,
+    MESH_MOVE|75, 175,
+    MESH_MOVE|98, 198,
+    MESH_MOVE|76, 176,
+    MESH_MOVE|77, 177,
+    MESH_MOVE|78, 178,
+    MESH_MOVE|79, 179,
+    MESH_MOVE|99, 199,
+    MESH_MOVE|0, 100,
+    MESH_MOVE|1, 101,
+    MESH_MOVE|2, 102,
+    MESH_MOVE|3, 103,
+};
+
+const model_t glxgear1_model = { glxgear1_vertices, glxgear1_indices, 200, 418, FLOAT_C(1.0/16), 0 };
+// vertices=200 indices=418 bytes=1436, was bytes=5434 as point_t with 32 bit FLOAT
+
+
+const int8_t glxgear2_vertices[] =
+{
+    53, 0, -32,
+    74, 12, -32,
+    72, 23, -32,
+    47, 24, -32,
+    43, 31, -32,
+    53, 53, -32,
+    44, 61, -32,
+    24, 47, -32,
+    16, 50, -32,
+    12, 74, -32,
+    0, 75, -32,
+    -8, 52, -32,
+    -16, 50, -32,
+    -34, 67, -32,
+    -44, 61, -32,
+    -37, 37, -32,
+    -43, 31, -32,
+    -67, 34, -32,
+    -72, 23, -32,
+    -52, 8, -32,
+    -53, 0, -32,
+    -74, -12, -32,
+    -72, -23, -32,
+    -47, -24, -32,
+    -43, -31, -32,
+    -53, -53, -32,
+    -44, -61, -32,
+    -24, -47, -32,
+    -16, -50, -32,
+    -12, -74, -32,
+    0, -75, -32,
+    8, -52, -32,
+    16, -50, -32,
+    34, -67, -32,
+    44, -61, -32,
+    37, -37, -32,
+    43, -31, -32,
+    67, -34, -32,
+    72, -23, -32,
+    52, -8, -32,
+    16, 0, -32,
+    13, 9, -32,
+    5, 15, -32,
+    -5, 15, -32,
+    -13, 9, -32,
+    -16, 0, -32,
+    -13, -9, -32,
+    -5, -15, -32,
+    5, -15, -32,
+    13, -9, -32,
+    53, 0, 32,
+    74, 12, 32,
+    72, 23, 32,
+    47, 24, 32,
+    43, 31, 32,
+    53, 53, 32,
+    44, 61, 32,
+    24, 47, 32,
+    16, 50, 32,
+    12, 74, 32,
+    0, 75, 32,
+    -8, 52, 32,
+    -16, 50, 32,
+    -34, 67, 32,
+    -44, 61, 32,
+    -37, 37, 32,
+    -43, 31, 32,
+    -67, 34, 32,
+    -72, 23, 32,
+    -52, 8, 32,
+    -53, 0, 32,
+    -74, -12, 32,
+    -72, -23, 32,
+    -47, -24, 32,
+    -43, -31, 32,
+    -53, -53, 32,
+    -44, -61, 32,
+    -24, -47, 32,
+    -16, -50, 32,
+    -12, -74, 32,
+    0, -75, 32,
+    8, -52, 32,
+    16, -50, 32,
+    34, -67, 32,
+    44, -61, 32,
+    37, -37, 32,
+    43, -31, 32,
+    67, -34, 32,
+    72, -23, 32,
+    52, -8, 32,
+    16, 0, 32,
+    13, 9, 32,
+    5, 15, 32,
+    -5, 15, 32,
+    -13, 9, 32,
+    -16, 0, 32,
+    -13, -9, 32,
+    -5, -15, 32,
+    5, -15, 32,
+    13, -9, 32,
+};
+
+const uint16_t glxgear2_indices[] =
+{
+    MESH_MOVE|0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 0, 1, 2, 3,
+    MESH_MOVE|40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 40,
+    MESH_MOVE|50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 50, 51, 52, 53,
+    MESH_MOVE|90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 90,
+    MESH_MOVE|0, 50,
+    MESH_MOVE|1, 51,
+    MESH_MOVE|2, 52,
+    MESH_MOVE|3, 53,
+    MESH_MOVE|40, 90,
+    MESH_MOVE|4, 54,
+    MESH_MOVE|5, 55,
+    MESH_MOVE|6, 56,
+    MESH_MOVE|7, 57,
+    MESH_MOVE|41, 91,
+    MESH_MOVE|8, 58,
+    MESH_MOVE|9, 59,
+    MESH_MOVE|10, 60,
+    MESH_MOVE|11, 61,
+    MESH_MOVE|42, 92,
+    MESH_MOVE|12, 62,
+    MESH_MOVE|13, 63,
+    MESH_MOVE|14, 64,
+    MESH_MOVE|15, 65,
+    MESH_MOVE|43, 93,
+    MESH_MOVE|16, 66,
+    MESH_MOVE|17, 67,
+    MESH_MOVE|18, 68,
+    MESH_MOVE|19, 69,
+    MESH_MOVE|44, 94,
+    MESH_MOVE|20, 70,
+    MESH_MOVE|21, 71,
+    MESH_MOVE|22, 72,
+    MESH_MOVE|23, 73,
+    MESH_MOVE|45, 95,
+    MESH_MOVE|24, 74,
+    MESH_MOVE|25, 75,
+    MESH_MOVE|26, 76,
+    MESH_MOVE|27, 77,
+    MESH_MOVE|46, 96,
+    MESH_MOVE|28, 78,
+    MESH_MOVE|29, 79,
+    MESH_MOVE|30, 80,
+    MESH_MOVE|31, 81,
+    MESH_MOVE|47, 97,
+    MESH_MOVE|32, 82,
+    MESH_MOVE|33, 83,
+    MESH_MOVE|34, 84,
+    MESH_MOVE|35, 85,
+    MESH_MOVE|48, 98,
+    MESH_MOVE|36, 86,
+    MESH_MOVE|37, 87,
+    MESH_MOVE|38, 88,
+    MESH_MOVE|39, 89,
+    MESH_MOVE|49, 99,
+    MESH_MOVE|0, 50,
+    MESH_MOVE|1, 51,
+    MESH_MOVE|2, 52,
+    MESH_MOVE|3, 53,
+};
+
+const model_t glxgear2_model = { glxgear2_vertices, glxgear2_indices, 100, 218, FLOAT_C(1.0/32), 0 };
+// vertices=100 indices=218 bytes=736, was bytes=2834 as point_t with 32 bit FLOAT
+
+
+const int8_t glxgear3_vertices[] =
+{
+    53, 0, -8,
+    74, 12, -8,
+    72, 23, -8,
+    47, 24, -8,
+    43, 31, -8,
+    53, 53, -8,
+    44, 61, -8,
+    24, 47, -8,
+    16, 50, -8,
+    12, 74, -8,
+    0, 75, -8,
+    -8, 52, -8,
+    -16, 50, -8,
+    -34, 67, -8,
+    -44, 61, -8,
+    -37, 37, -8,
+    -43, 31, -8,
+    -67, 34, -8,
+    -72, 23, -8,
+    -52, 8, -8,
+    -53, 0, -8,
+    -74, -12, -8,
+    -72, -23, -8,
+    -47, -24, -8,
+    -43, -31, -8,
+    -53, -53, -8,
+    -44, -61, -8,
+    -24, -47, -8,
+    -16, -50, -8,
+    -12, -74, -8,
+    0, -75, -8,
+    8, -52, -8,
+    16, -50, -8,
+    34, -67, -8,
+    44, -61, -8,
+    37, -37, -8,
+    43, -31, -8,
+    67, -34, -8,
+    72, -23, -8,
+    52, -8, -8,
+    42, 0, -8,
+    34, 24, -8,
+    13, 40, -8,
+    -13, 40, -8,
+    -34, 24, -8,
+    -42, 0, -8,
+    -34, -24, -8,
+    -13, -40, -8,
+    13, -40, -8,
+    34, -24, -8,
+    53, 0, 8,
+    74, 12, 8,
+    72, 23, 8,
+    47, 24, 8,
+    43, 31, 8,
+    53, 53, 8,
+    44, 61, 8,
+    24, 47, 8,
+    16, 50, 8,
+    12, 74, 8,
+    0, 75, 8,
+    -8, 52, 8,
+    -16, 50, 8,
+    -34, 67, 8,
+    -44, 61, 8,
+    -37, 37, 8,
+    -43, 31, 8,
+    -67, 34, 8,
+    -72, 23, 8,
+    -52, 8, 8,
+    -53, 0, 8,
+    -74, -12, 8,
+    -72, -23, 8,
+    -47, -24, 8,
+    -43, -31, 8,
+    -53, -53, 8,
+    -44, -61, 8,
+    -24, -47, 8,
+    -16, -50, 8,
+    -12, -74, 8,
+    0, -75, 8,
+    8, -52, 8,
+    16, -50, 8,
+    34, -67, 8,
+    44, -61, 8,
+    37, -37, 8,
+    43, -31, 8,
+    67, -34, 8,
+    72, -23, 8,
+    52, -8, 8,
+    42, 0, 8,
+    34, 24, 8,
+    13, 40, 8,
+    -13, 40, 8,
+    -34, 24, 8,
+    -42, 0, 8,
+    -34, -24, 8,
+    -13, -40, 8,
+    13, -40, 8,
+    34, -24, 8,
+};
+
+const uint16_t glxgear3_indices[] =
+{
+    MESH_MOVE|0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 0, 1, 2, 3,
+    MESH_MOVE|40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 40,
+    MESH_MOVE|50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 50, 51, 52, 53,
+    MESH_MOVE|90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 90,
+    MESH_MOVE|0, 50,
+    MESH_MOVE|1, 51,
+    MESH_MOVE|2, 52,
+    MESH_MOVE|3, 53,
+    MESH_MOVE|40, 90,
+    MESH_MOVE|4, 54,
+    MESH_MOVE|5, 55,
+    MESH_MOVE|6, 56,
+    MESH_MOVE|7, 57,
+    MESH_MOVE|41, 91,
+    MESH_MOVE|8, 58,
+    MESH_MOVE|9, 59,
+    MESH_MOVE|10, 60,
+    MESH_MOVE|11, 61,
+    MESH_MOVE|42, 92,
+    MESH_MOVE|12, 62,
+    MESH_MOVE|13, 63,
+    MESH_MOVE|14, 64,
+    MESH_MOVE|15, 65,
+    MESH_MOVE|43, 93,
+    MESH_MOVE|16, 66,
+    MESH_MOVE|17, 67,
+    MESH_MOVE|18, 68,
+    MESH_MOVE|19, 69,
+    MESH_MOVE|44, 94,
+    MESH_MOVE|20, 70,
+    MESH_MOVE|21, 71,
+    MESH_MOVE|22, 72,
+    MESH_MOVE|23, 73,
+    MESH_MOVE|45, 95,
+    MESH_MOVE|24, 74,
+    MESH_MOVE|25, 75,
+    MESH_MOVE|26, 76,
+    MESH_MOVE|27, 77,
+    MESH_MOVE|46, 96,
+    MESH_MOVE|28, 78,
+    MESH_MOVE|29, 79,
+    MESH_MOVE|30, 80,
+    MESH_MOVE|31, 81,
+    MESH_MOVE|47, 97,
+    MESH_MOVE|32, 82,
+    MESH_MOVE|33, 83,
+    MESH_MOVE|34, 84,
+    MESH_MOVE|35, 85,
+    MESH_MOVE|48, 98,
+    MESH_MOVE|36, 86,
+    MESH_MOVE|37, 87,
+    MESH_MOVE|38, 88,
+    MESH_MOVE|39, 89,
+    MESH_MOVE|49, 99,
+    MESH_MOVE|0, 50,
+    MESH_MOVE|1, 51,
+    MESH_MOVE|2, 52,
+    MESH_MOVE|3, 53,
+};
+
+const model_t glxgear3_model = { glxgear3_vertices, glxgear3_indices, 100, 218, FLOAT_C(1.0/32), 0 };
+// vertices=100 indices=218 bytes=736, was bytes=2834 as point_t with 32 bit FLOAT
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* _MODELS_PACKED_H  */
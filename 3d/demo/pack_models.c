@@ -0,0 +1,156 @@
+/*
+ * pack_models.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Host converter from the point_t polyline models in models.h to packed
+ * model_t models, each with its unique vertices stored once as integers
+ * with a scale, and its polylines as vertex indices.
+ *
+ * The scale is a power of two, so that the vertices are expanded exactly
+ * by every FLOAT type, including Q16.16 fixed point.
+ *
+ * cc -o pack_models pack_models.c
+ * ./pack_models > models_packed.h          int8_t vertices
+ * ./pack_models -16 > models_packed.h      int16_t vertices
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#define FLOAT       float
+#define FLOAT_C(c)  ((FLOAT)(c))
+
+#include "models.h"
+
+#define MESH_MOVE   0x8000      // as in 3d.h
+
+#define MODEL(m)    { #m, m, sizeof(m) / sizeof(point_t) }
+
+typedef struct model_source_s
+{
+    char const * name;
+    point_t const * points;
+    uint16_t count;
+} model_source_t;
+
+model_source_t const models[] =
+{
+    MODEL(cube),
+    MODEL(icos),
+    MODEL(gear),
+    MODEL(glxgear1),
+    MODEL(glxgear2),
+    MODEL(glxgear3),
+};
+
+
+void pack_model(model_source_t const * model, uint8_t int16)
+{
+    point_t const ** vertices = malloc(model->count * sizeof(point_t const *));
+    uint16_t * indices = malloc(model->count * sizeof(uint16_t));
+    uint16_t vertex_count = 0;
+    FLOAT extent = 0;
+    int16_t shift = 0;
+    int32_t limit = int16 ? INT16_MAX : INT8_MAX;
+
+    for(uint16_t i = 0; i < model->count; ++i)
+    {
+        point_t const * point = &model->points[i];
+        uint16_t j;
+
+        for(j = 0; j < vertex_count; ++j)
+        {
+            if(vertices[j]->x == point->x && vertices[j]->y == point->y && vertices[j]->z == point->z) break;
+        }
+
+        if(j == vertex_count)
+        {
+            vertices[vertex_count++] = point;
+            if(fabsf(point->x) > extent) extent = fabsf(point->x);
+            if(fabsf(point->y) > extent) extent = fabsf(point->y);
+            if(fabsf(point->z) > extent) extent = fabsf(point->z);
+        }
+
+        indices[i] = point->begin_poly ? (j | MESH_MOVE) : j;
+    }
+
+    /* the finest power of two scale which keeps every vertex within limit */
+    while(lroundf(ldexpf(extent, shift + 1)) <= limit && shift < 16) ++shift;
+
+    printf("const %s %s_vertices[] =\n{\n", int16 ? "int16_t" : "int8_t", model->name);
+    for(uint16_t j = 0; j < vertex_count; ++j)
+    {
+        printf("    %ld, %ld, %ld,\n",
+            lroundf(ldexpf(vertices[j]->x, shift)),
+            lroundf(ldexpf(vertices[j]->y, shift)),
+            lroundf(ldexpf(vertices[j]->z, shift)));
+    }
+    printf("};\n\n");
+
+    printf("const uint16_t %s_indices[] =\n{", model->name);
+    for(uint16_t i = 0; i < model->count; ++i)
+    {
+        if(indices[i] & MESH_MOVE)
+            printf("\n    MESH_MOVE|%u,", indices[i] & ~MESH_MOVE);
+        else
+            printf(" %u,", indices[i]);
+    }
+    printf("\n};\n\n");
+
+    printf("const model_t %s_model = { %s_vertices, %s_indices, %u, %u, FLOAT_C(1.0/%ld), %s };\n",
+        model->name, model->name, model->name, vertex_count, model->count, 1L << shift, int16 ? "MODEL_INT16" : "0");
+    printf("// vertices=%u indices=%u bytes=%u, was bytes=%u as point_t with 32 bit FLOAT\n\n\n",
+        vertex_count, model->count,
+        (unsigned)(vertex_count * 3 * (int16 ? 2 : 1) + model->count * 2),
+        (unsigned)(model->count * 13));
+
+    free(vertices);
+    free(indices);
+}
+
+
+int main(int argc, char **argv)
+{
+    uint8_t int16 = (argc > 1 && strcmp(argv[1], "-16") == 0);
+
+    printf("// packed models, generated from models.h by pack_models.c\n\n");
+    printf("#ifndef _MODELS_PACKED_H\n#define _MODELS_PACKED_H\n\n");
+    printf("#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n\n");
+
+    for(uint8_t i = 0; i < sizeof(models) / sizeof(model_source_t); ++i)
+    {
+        pack_model(&models[i], int16);
+    }
+
+    printf("#ifdef __cplusplus\n}\n#endif\n\n");
+    printf("#endif  /* _MODELS_PACKED_H  */\n");
+
+    return 0;
+}
@@ -0,0 +1,83 @@
+/*
+ * add_lines.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+/* Add a screen line x0,y0,x1,y1 to this frame, returning 0 if the list is full */
+uint8_t add_lines(lines_t * lines, int16_t const * line)
+{
+    uint8_t current = lines->current;
+    uint16_t count = lines->count[current];
+
+    if(count == lines->capacity) return 0;
+
+    int16_t * next = lines->line[current] + (count << 2);
+
+    /* the same line drawn either way round is kept with the same end first */
+    if(line[0] < line[2] || (line[0] == line[2] && line[1] <= line[3]))
+    {
+        next[0] = line[0]; next[1] = line[1];
+        next[2] = line[2]; next[3] = line[3];
+    }
+    else
+    {
+        next[0] = line[2]; next[1] = line[3];
+        next[2] = line[0]; next[3] = line[1];
+    }
+
+    lines->count[current] = count + 1;
+    return 1;
+}
@@ -0,0 +1,93 @@
+/*
+ * bound_sphere.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+/* Produce a bounding sphere centre for the vertices, and return its radius */
+FLOAT bound_sphere(vector_t * centre, vector_t const * vertices, uint16_t count)
+{
+    vector_t const * vertex = vertices;
+    vector_t min = *vertices;
+    vector_t max = *vertices;
+    FLOAT radius = FLOAT_C(0.0);
+
+    for(uint16_t i = 0; i != count; ++i, ++vertex)  /* centre of the bounding box */
+    {
+        if(vertex->x < min.x) min.x = vertex->x;
+        if(vertex->y < min.y) min.y = vertex->y;
+        if(vertex->z < min.z) min.z = vertex->z;
+        if(vertex->x > max.x) max.x = vertex->x;
+        if(vertex->y > max.y) max.y = vertex->y;
+        if(vertex->z > max.z) max.z = vertex->z;
+    }
+
+    centre->x = MUL(min.x + max.x, FLOAT_C(0.5));
+    centre->y = MUL(min.y + max.y, FLOAT_C(0.5));
+    centre->z = MUL(min.z + max.z, FLOAT_C(0.5));
+    centre->w = FLOAT_C(1.0);
+
+    vertex = vertices;
+
+    for(uint16_t i = 0; i != count; ++i, ++vertex)  /* furthest vertex, squared */
+    {
+        FLOAT distance = SQR(vertex->x - centre->x) + SQR(vertex->y - centre->y) + SQR(vertex->z - centre->z);
+
+        if(distance > radius) radius = distance;
+    }
+
+    return SQRT(radius);
+}
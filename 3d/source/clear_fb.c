@@ -0,0 +1,84 @@
+/*
+ * clear_fb.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+/* Clear the rectangle drawn since the last clear, marking it dirty */
+void clear_fb(framebuffer_t * fb)
+{
+    int16_t * drawn = fb->drawn;
+    int16_t * dirty = fb->dirty;
+
+    if(drawn[2] < drawn[0]) return;             /* nothing drawn */
+
+    uint8_t * row = fb->buffer + (drawn[1] >> 3) * fb->width + drawn[0];
+    uint16_t length = drawn[2] - drawn[0] + 1;
+
+    for(uint8_t page = drawn[1] >> 3; page <= (drawn[3] >> 3); ++page)
+    {
+        memset(row, 0, length);
+        row += fb->width;
+    }
+
+    if(drawn[0] < dirty[0]) dirty[0] = drawn[0];
+    if(drawn[1] < dirty[1]) dirty[1] = drawn[1];
+    if(drawn[2] > dirty[2]) dirty[2] = drawn[2];
+    if(drawn[3] > dirty[3]) dirty[3] = drawn[3];
+
+    drawn[0] = drawn[1] = INT16_MAX;
+    drawn[2] = drawn[3] = -1;
+}
@@ -0,0 +1,138 @@
+/*
+ * clip_line.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+/* Distance inside the plane, for planes -x +x -y +y -z +z in order, negative when outside */
+static FLOAT clip_distance(vector_t const * vect, uint8_t plane)
+{
+    FLOAT const * c = &vect->x + (plane >> 1);
+
+    return (plane & 0x01) ? vect->w - *c : vect->w + *c;
+}
+
+
+/* Move a vector to position t along the line from start to end, z is not needed after clipping */
+static void clip_lerp(vector_t * vect, vector_t const * start, vector_t const * end, FLOAT t)
+{
+    vect->x = start->x + MUL(end->x - start->x, t);
+    vect->y = start->y + MUL(end->y - start->y, t);
+    vect->w = start->w + MUL(end->w - start->w, t);
+}
+
+
+/* Clip a line in homogeneous clip space, and produce its screen end points x0,y0,x1,y1 */
+uint8_t clip_line(vector_t const * start, vector_t const * end, viewport_t const * viewport, int16_t * line)
+{
+    vector_t s;
+    vector_t e;
+
+    uint8_t outcode_start = outcode_v(start);
+    uint8_t outcode_end = outcode_v(end);
+    uint8_t clipped = CLIP_VISIBLE;
+
+    if(outcode_start & outcode_end)     /* both outside the same plane, trivial reject */
+        return 0;
+
+    s = *start;
+    e = *end;
+
+    if(outcode_start | outcode_end)     /* crossing at least one plane */
+    {
+        uint8_t crossed = outcode_start | outcode_end;
+        FLOAT t_start = FLOAT_C(0.0);
+        FLOAT t_end = FLOAT_C(1.0);
+
+        for(uint8_t plane = 0; crossed; ++plane, crossed >>= 1)
+        {
+            if(crossed & 0x01)
+            {
+                FLOAT d_start = clip_distance(start, plane);
+                FLOAT d_end = clip_distance(end, plane);
+                FLOAT t = DIV(d_start, d_start - d_end);
+
+                if(d_start < 0)
+                {
+                    if(t > t_start) t_start = t;
+                }
+                else
+                {
+                    if(t < t_end) t_end = t;
+                }
+            }
+        }
+
+        if(t_start > t_end)             /* passes outside a corner of the view volume */
+            return 0;
+
+        if(outcode_start)
+        {
+            clip_lerp(&s, start, end, t_start);
+            clipped |= CLIP_START;
+        }
+        if(outcode_end)
+        {
+            clip_lerp(&e, start, end, t_end);
+            clipped |= CLIP_END;
+        }
+    }
+
+    project_v(&s, viewport, &line[0], &line[1]);
+    project_v(&e, viewport, &line[2], &line[3]);
+
+    return clipped;
+}
@@ -0,0 +1,95 @@
+/*
+ * cull_sphere.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+/* Test whether a sphere in model space is entirely outside the view volume of a model view projection matrix */
+uint8_t cull_sphere(vector_t const * centre, FLOAT radius, matrix_t const * multiplier)
+{
+    FLOAT const * m = multiplier->e;
+    FLOAT radius_squared = SQR(radius);
+
+    /* the planes -x +x -y +y -z +z are the w column plus or minus the x, y or z column */
+    for(uint8_t plane = 0; plane != 6; ++plane)
+    {
+        FLOAT const * e = &m[plane >> 1];
+        FLOAT a, b, c, d, distance;
+
+        if(plane & 0x01)
+        {
+            a = m[3]  - e[0];
+            b = m[7]  - e[4];
+            c = m[11] - e[8];
+            d = m[15] - e[12];
+        }
+        else
+        {
+            a = m[3]  + e[0];
+            b = m[7]  + e[4];
+            c = m[11] + e[8];
+            d = m[15] + e[12];
+        }
+
+        distance = MUL(a, centre->x) + MUL(b, centre->y) + MUL(c, centre->z) + d;
+
+        /* outside when further than the radius, compared squared to avoid normalising the plane */
+        if(distance < 0 && SQR(distance) > MUL(radius_squared, SQR(a) + SQR(b) + SQR(c)))
+            return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+ * delta_q.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+/* Rotate a unit quaternion by small angles about its own x, y and z axes, without trigonometry */
+void delta_q(quat_t * quat, FLOAT x, FLOAT y, FLOAT z)
+{
+    FLOAT qx = quat->x;
+    FLOAT qy = quat->y;
+    FLOAT qz = quat->z;
+    FLOAT qw = quat->w;
+
+    /* first order quaternion for the small rotation is (x/2, y/2, z/2, 1) */
+    x = MUL(x, FLOAT_C(0.5));
+    y = MUL(y, FLOAT_C(0.5));
+    z = MUL(z, FLOAT_C(0.5));
+
+    quat->x = qx + MUL(qw, x) + MUL(qy, z) - MUL(qz, y);
+    quat->y = qy + MUL(qw, y) - MUL(qx, z) + MUL(qz, x);
+    quat->z = qz + MUL(qw, z) + MUL(qx, y) - MUL(qy, x);
+    quat->w = qw - MUL(qx, x) - MUL(qy, y) - MUL(qz, z);
+
+    unit_q(quat);
+}
@@ -0,0 +1,95 @@
+/*
+ * divfix.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+#ifdef __MATH_FIXED
+
+/* Q16.16 fixed point division, saturating on overflow */
+FLOAT divfix(FLOAT dividend, FLOAT divisor)
+{
+    uint32_t a;
+    uint32_t b;
+    uint32_t quotient;
+    uint8_t negative = 0;
+
+    if(dividend < 0) { a = -dividend; negative = 1; } else { a = dividend; }
+    if(divisor < 0) { b = -divisor; negative ^= 1; } else { b = divisor; }
+
+    if(b == 0 || (a >> 15) >= b)                // quotient integer part won't fit
+    {
+        return negative ? INT32_MIN+1 : INT32_MAX;
+    }
+
+    quotient = a / b;                           // integer part
+    a -= quotient * b;                          // remainder, less than b
+
+    /* long division for the 16 fraction bits */
+    for(uint8_t i = 0; i != 16; ++i)
+    {
+        quotient <<= 1;
+        a <<= 1;
+        if(a >= b)
+        {
+            a -= b;
+            quotient |= 1;
+        }
+    }
+
+    return negative ? -(FLOAT)quotient : (FLOAT)quotient;
+}
+
+#endif
@@ -0,0 +1,191 @@
+/*
+ * dot_apu.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+#ifdef __3D_APU
+
+#if !defined(__IO_APU_DATA) || !defined(__IO_APU_CONTROL)
+#error "Am9511 APU ports unknown, define __IO_APU_DATA and __IO_APU_CONTROL for the target"
+#endif
+
+#define APU_FADD            0x10    // Am9511 floating point commands
+#define APU_FMUL            0x12
+
+#define APU_BUSY            0x80    // Am9511 status busy bit
+
+__sfr __at __IO_APU_DATA    io_apu_data;
+__sfr __at __IO_APU_CONTROL io_apu_control;
+
+
+/* Convert an IEEE float to Am9511 float format, in push order, LSB first */
+static void apu_from_float(uint8_t * apu, FLOAT const * f)
+{
+    uint8_t const * ieee = (uint8_t const *)f;
+    int16_t exponent = (uint8_t)((ieee[3] << 1) | (ieee[2] >> 7));
+
+    if(exponent == 0)               /* zero, and denormals flushed to zero */
+    {
+        apu[0] = apu[1] = apu[2] = apu[3] = 0;
+        return;
+    }
+
+    exponent -= 126;                /* IEEE 1.m x 2^(e-127) is APU 0.1m x 2^(e-126) */
+
+    if(exponent < -64)              /* underflow to zero */
+    {
+        apu[0] = apu[1] = apu[2] = apu[3] = 0;
+    }
+    else if(exponent > 63)          /* saturate on overflow */
+    {
+        apu[0] = apu[1] = apu[2] = 0xFF;
+        apu[3] = (ieee[3] & 0x80) | 0x3F;
+    }
+    else
+    {
+        apu[0] = ieee[0];
+        apu[1] = ieee[1];
+        apu[2] = ieee[2] | 0x80;    /* explicit leading mantissa bit */
+        apu[3] = (ieee[3] & 0x80) | ((uint8_t)exponent & 0x7F);
+    }
+}
+
+
+/* Push a converted operand onto the APU stack, LSB first */
+static void apu_push(uint8_t const * apu)
+{
+    while(io_apu_control & APU_BUSY);
+
+    io_apu_data = apu[0];
+    io_apu_data = apu[1];
+    io_apu_data = apu[2];
+    io_apu_data = apu[3];
+}
+
+
+/* Issue an APU command, once the previous command has completed */
+static void apu_command(uint8_t command)
+{
+    while(io_apu_control & APU_BUSY);
+
+    io_apu_control = command;
+}
+
+
+/* Pop the APU stack, MSB first, and convert it to an IEEE float */
+static FLOAT apu_pop(void)
+{
+    FLOAT f;
+    uint8_t * ieee = (uint8_t *)&f;
+    uint8_t apu3, apu2;
+    int16_t exponent;
+
+    while(io_apu_control & APU_BUSY);
+
+    apu3 = io_apu_data;
+    apu2 = io_apu_data;
+    ieee[1] = io_apu_data;
+    ieee[0] = io_apu_data;
+
+    if(!(apu2 & 0x80))              /* zero has no leading mantissa bit */
+        return FLOAT_C(0.0);
+
+    exponent = (int16_t)(apu3 & 0x7F);
+    if(exponent & 0x40) exponent -= 0x80;   /* signed 7 bit exponent */
+    exponent += 126;
+
+    ieee[3] = (apu3 & 0x80) | (uint8_t)(exponent >> 1);
+    ieee[2] = (uint8_t)(exponent << 7) | (apu2 & 0x7F);
+
+    return f;
+}
+
+
+/* Am9511 APU dot product of count elements, vect2 elements stride apart, keeping the partial sums on the APU stack */
+FLOAT dot_apu(FLOAT const * vect1, FLOAT const * vect2, uint8_t stride, uint8_t count)
+{
+    uint8_t a[4];
+    uint8_t b[4];
+
+    apu_from_float(a, vect1);
+    apu_from_float(b, vect2);
+    apu_push(a);
+    apu_push(b);
+    apu_command(APU_FMUL);
+
+    for(uint8_t i = 1; i != count; ++i)
+    {
+        vect1 += 1;
+        vect2 += stride;
+
+        /* convert the next operands while the APU multiplies */
+        apu_from_float(a, vect1);
+        apu_from_float(b, vect2);
+
+        /* add the previous product into the sum, leaving room on the APU stack */
+        if(i != 1) apu_command(APU_FADD);
+
+        apu_push(a);
+        apu_push(b);
+        apu_command(APU_FMUL);
+    }
+
+    if(count != 1) apu_command(APU_FADD);
+
+    return apu_pop();
+}
+
+#endif
@@ -59,5 +59,9 @@
 /* Produce a dot product between vectors */
 FLOAT dot_v(vector_t * vect1,vector_t * vect2)
 {
-    return vect1->x * vect2->x + vect1->y * vect2->y + vect1->z * vect2->z;
+#ifdef __3D_APU
+    return dot_apu(&vect1->x, &vect2->x, 1, 3);
+#else
+    return MUL(vect1->x, vect2->x) + MUL(vect1->y, vect2->y) + MUL(vect1->z, vect2->z);
+#endif
 }
@@ -0,0 +1,101 @@
+/*
+ * draw_lines.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+/*
+ * Erasing a line also erases the pixels it shares with lines which are
+ * kept. Those lines can only cross an erased line within the box of all
+ * the erased lines, so kept lines reaching into the box are drawn again,
+ * together with the new lines.
+ */
+
+/* Draw the lines of this frame not in the last, redraw kept lines reaching into box x0,y0,x1,y1, and begin the next frame */
+void draw_lines(lines_t * lines, void (*draw)(int16_t const * line), int16_t const * box)
+{
+    uint8_t current = lines->current;
+    int16_t * last_line = lines->line[current ^ 1];
+    int16_t * this_line = lines->line[current];
+    uint16_t * table = lines->table;
+    uint16_t mask = lines->mask;
+    int16_t const * line;
+    uint16_t h;
+
+    for(h = 0; h <= mask; ++h)
+    {
+        uint16_t entry = table[h];
+
+        if(entry & LINES_NEW)
+        {
+            draw(this_line + (((entry & LINES_INDEX) - 1) << 2));
+        }
+        else if(entry & LINES_KEPT)
+        {
+            line = last_line + (((entry & LINES_INDEX) - 1) << 2);
+
+            if(!((line[0] < box[0] && line[2] < box[0]) ||
+                 (line[0] > box[2] && line[2] > box[2]) ||
+                 (line[1] < box[1] && line[3] < box[1]) ||
+                 (line[1] > box[3] && line[3] > box[3])))
+            {
+                draw(line);
+            }
+        }
+    }
+
+    lines->current = current ^ 1;
+    lines->count[current ^ 1] = 0;
+}
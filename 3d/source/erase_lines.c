@@ -0,0 +1,164 @@
+/*
+ * erase_lines.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+/*
+ * The lines of the last frame are entered into an open addressed hash
+ * table, as their index + 1. Each line of this frame is then looked up.
+ * A line found from the last frame is marked LINES_KEPT, and otherwise it
+ * is entered as LINES_NEW, so it is drawn only once however often it is
+ * repeated. The lines of the last frame which were not marked are erased,
+ * and the table is kept for draw_lines().
+ *
+ * add_lines() stores each line with its lower end first, but the hash and
+ * comparison do not depend on it, so a line is matched whichever way round
+ * its end points were stored.
+ */
+
+static uint16_t hash_point(int16_t x, int16_t y)
+{
+    return (uint16_t)x ^ ((uint16_t)y << 5) ^ ((uint16_t)y >> 11);
+}
+
+
+static uint16_t hash_line(int16_t const * line)
+{
+    return hash_point(line[0], line[1]) + hash_point(line[2], line[3]);
+}
+
+
+static uint8_t same_line(int16_t const * a, int16_t const * b)
+{
+    return (a[0] == b[0] && a[1] == b[1] && a[2] == b[2] && a[3] == b[3]) ||
+           (a[0] == b[2] && a[1] == b[3] && a[2] == b[0] && a[3] == b[1]);
+}
+
+
+/* Erase the lines of the last frame not in this frame, growing box x0,y0,x1,y1 to cover them */
+void erase_lines(lines_t * lines, void (*erase)(int16_t const * line), int16_t * box)
+{
+    uint8_t current = lines->current;
+    int16_t * last_line = lines->line[current ^ 1];
+    int16_t * this_line = lines->line[current];
+    uint16_t * table = lines->table;
+    uint16_t mask = lines->mask;
+    int16_t const * line;
+    uint16_t i;
+    uint16_t h;
+
+    memset(table, 0, (mask + 1) * sizeof(uint16_t));
+
+    line = last_line;
+    for(i = 0; i != lines->count[current ^ 1]; ++i, line += 4)
+    {
+        h = hash_line(line) & mask;
+
+        while(table[h])
+        {
+            if(same_line(last_line + (((table[h] & LINES_INDEX) - 1) << 2), line)) break;
+            h = (h + 1) & mask;
+        }
+
+        if(!table[h]) table[h] = i + 1;     /* repeated lines are entered once */
+    }
+
+    line = this_line;
+    for(i = 0; i != lines->count[current]; ++i, line += 4)
+    {
+        uint16_t entry;
+
+        h = hash_line(line) & mask;
+
+        while((entry = table[h]))
+        {
+            int16_t * found = ((entry & LINES_NEW) ? this_line : last_line) + (((entry & LINES_INDEX) - 1) << 2);
+
+            if(same_line(found, line)) break;
+            h = (h + 1) & mask;
+        }
+
+        if(!entry)
+        {
+            table[h] = (i + 1) | LINES_NEW;
+        }
+        else if(!(entry & LINES_NEW))
+        {
+            table[h] = entry | LINES_KEPT;
+        }
+    }
+
+    for(h = 0; h <= mask; ++h)
+    {
+        uint16_t entry = table[h];
+
+        if(entry && !(entry & (LINES_KEPT|LINES_NEW)))
+        {
+            line = last_line + ((entry - 1) << 2);
+            erase(line);
+
+            if(line[0] < box[0]) box[0] = line[0];
+            if(line[2] < box[0]) box[0] = line[2];
+            if(line[1] < box[1]) box[1] = line[1];
+            if(line[3] < box[1]) box[1] = line[3];
+            if(line[0] > box[2]) box[2] = line[0];
+            if(line[2] > box[2]) box[2] = line[2];
+            if(line[1] > box[3]) box[3] = line[1];
+            if(line[3] > box[3]) box[3] = line[3];
+        }
+    }
+}
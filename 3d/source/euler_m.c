@@ -0,0 +1,98 @@
+/*
+ * euler_m.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+/* Rotation in x, then y, then z dimensions, as rotx_m() roty_m() rotz_m() */
+void euler_m(matrix_t * matrix, FLOAT x, FLOAT y, FLOAT z)
+{
+    FLOAT r[9];
+    FLOAT * e = matrix->e;
+
+    FLOAT cx = COS(x);
+    FLOAT sx = SIN(x);
+    FLOAT cy = COS(y);
+    FLOAT sy = SIN(y);
+    FLOAT cz = COS(z);
+    FLOAT sz = SIN(z);
+
+    FLOAT sxsy = MUL(sx, sy);
+    FLOAT cxsy = MUL(cx, sy);
+
+    /* combined 3x3 rotation, Rx * Ry * Rz */
+    r[0] =  MUL(cy, cz);
+    r[1] = -MUL(cy, sz);
+    r[2] =  sy;
+    r[3] =  MUL(sxsy, cz) + MUL(cx, sz);
+    r[4] =  MUL(cx, cz) - MUL(sxsy, sz);
+    r[5] = -MUL(sx, cy);
+    r[6] =  MUL(sx, sz) - MUL(cxsy, cz);
+    r[7] =  MUL(cxsy, sz) + MUL(sx, cz);
+    r[8] =  MUL(cx, cy);
+
+    /* only the x, y and z columns are changed */
+    for(uint8_t i = 0; i != MATRIX_ORDER; ++i) {
+        FLOAT e0 = e[0];
+        FLOAT e1 = e[1];
+        FLOAT e2 = e[2];
+
+        e[0] = MUL(e0, r[0]) + MUL(e1, r[3]) + MUL(e2, r[6]);
+        e[1] = MUL(e0, r[1]) + MUL(e1, r[4]) + MUL(e2, r[7]);
+        e[2] = MUL(e0, r[2]) + MUL(e1, r[5]) + MUL(e2, r[8]);
+
+        e += MATRIX_ORDER;
+    }
+}
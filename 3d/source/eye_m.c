@@ -0,0 +1,84 @@
+/*
+ * eye_m.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+/* Produce the eye (view space origin) position in the model space of a model view matrix */
+void eye_m(vector_t * eye, matrix_t const * modelview)
+{
+    FLOAT const * e = modelview->e;
+    vector_t r0, r1, r2, t, c;
+    FLOAT inv_det;
+
+    r0.x = e[0];    r0.y = e[1];    r0.z = e[2];
+    r1.x = e[4];    r1.y = e[5];    r1.z = e[6];
+    r2.x = e[8];    r2.y = e[9];    r2.z = e[10];
+    t.x = -e[12];   t.y = -e[13];   t.z = -e[14];
+
+    /* solve eye * modelview = origin by Cramer's rule, using cross products of the rows */
+    cross_v(&c, &r1, &r2);
+    inv_det = INV(dot_v(&r0, &c));
+    eye->x = MUL(dot_v(&t, &c), inv_det);
+
+    cross_v(&c, &r2, &r0);
+    eye->y = MUL(dot_v(&t, &c), inv_det);
+
+    cross_v(&c, &r0, &r1);
+    eye->z = MUL(dot_v(&t, &c), inv_det);
+
+    eye->w = FLOAT_C(1.0);
+}
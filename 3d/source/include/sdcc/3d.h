@@ -58,7 +58,39 @@ extern "C" {
 
 #define MATRIX_ORDER    4           // order for 3D homogeneous coordinate graphics
 
-#ifdef __MATH_AM9511
+#define CLIP_VISIBLE    0x01        // clip_line() line is at least partly within the view volume
+#define CLIP_START      0x02        // clip_line() start was moved onto the view volume
+#define CLIP_END        0x04        // clip_line() end was moved onto the view volume
+
+#define MESH_MOVE       0x8000      // mesh index flag, move to the vertex to begin a polyline
+#define MODEL_INT16     0x01        // model_t flag, vertices are int16_t rather than int8_t
+
+#define LINES_KEPT      0x8000      // lines_t table flag, line of the last frame also in this frame
+#define LINES_NEW       0x4000      // lines_t table flag, line of this frame not in the last frame
+#define LINES_INDEX     0x3FFF      // lines_t table line index + 1
+
+#ifdef __MATH_FIXED                 // Q16.16 fixed point, selected with -D__MATH_FIXED
+
+    #define FLOAT       int32_t
+
+    #define FLOAT_C(c)  ((FLOAT)((c) < 0 ? (c)*65536.0 - 0.5 : (c)*65536.0 + 0.5))
+    #define FTOI(x)     ((int16_t)((x)>>16))
+    #define ITOF(i)     ((FLOAT)(i)<<16)
+    #define Q14TOF(i)   ((FLOAT)(i)<<2)
+
+    #define MUL(a,b)    mulfix((a),(b))
+    #define DIV(a,b)    divfix((a),(b))
+
+    #define INV(x)      divfix(FLOAT_C(1.0),(x))
+    #define SQR(x)      mulfix((x),(x))
+    #define SQRT(x)     sqrtfix(x)
+    #define INVSQRT(x)  invsqrtfix(x)
+
+    #define COS(x)      cosfix(x)
+    #define SIN(x)      sinfix(x)
+    #define TAN(x)      tanfix(x)
+
+#elif __MATH_AM9511
 
     #define FLOAT       float_t
 
@@ -112,6 +144,34 @@ extern "C" {
 
 #endif
 
+#if defined(__3D_APU) && !defined(__MATH_AM9511)
+    #undef __3D_APU                 // Am9511 APU kernels, selected with -D__3D_APU for --am9511 only
+#endif
+
+#ifndef FLOAT_C                     // FLOAT is a floating point type
+
+    #define FLOAT_C(c)  ((FLOAT)(c))
+    #define FTOI(x)     ((int16_t)(x))
+    #define ITOF(i)     ((FLOAT)(i))
+    #define Q14TOF(i)   MUL(ITOF(i),FLOAT_C(1.0/16384))
+
+    #define MUL(a,b)    ((a)*(b))
+    #define DIV(a,b)    ((a)/(b))
+
+#endif
+
+#if defined(__3D_TABLE_TRIG) && !defined(__MATH_FIXED) // table driven trigonometry, selected with -D__3D_TABLE_TRIG
+
+    #undef COS
+    #undef SIN
+    #undef TAN
+
+    #define COS(x)      costab(x)
+    #define SIN(x)      sintab(x)
+    #define TAN(x)      tantab(x)
+
+#endif
+
 
 /****************************************************************************/
 /***          Type Definitions                                            ***/
@@ -132,6 +192,92 @@ typedef struct matrix_s // homogeneous coordinate system
 } matrix_t;
 
 
+typedef struct quat_s   // quaternion rotation
+{
+    FLOAT x;            // x vector part
+    FLOAT y;            // y vector part
+    FLOAT z;            // z vector part
+    FLOAT w;            // scalar part
+} quat_t;
+
+
+typedef struct viewport_s // normalised device coordinates to screen
+{
+    FLOAT x_scale;      // half the viewport width
+    FLOAT y_scale;      // half the viewport height, negative when screen y is down
+    FLOAT x_offset;     // screen x of the viewport centre
+    FLOAT y_offset;     // screen y of the viewport centre
+} viewport_t;
+
+
+typedef struct mesh_s   // indexed polyline mesh
+{
+    vector_t * vertices;        // unique vertices, w is taken to be 1
+    uint16_t const * indices;   // vertex index of each polyline point, or'ed with MESH_MOVE to begin a polyline
+    vector_t * planes;          // optional plane of each polyline for back face culling, zero if not a face, or NULL
+    uint16_t vertex_count;
+    uint16_t index_count;
+    vector_t centre;            // bounding sphere centre
+    FLOAT radius;               // bounding sphere radius
+} mesh_t;
+
+
+typedef struct model_s  // packed model, integer vertices with a scale, and polyline indices
+{
+    void const * vertices;      // x,y,z of each unique vertex, int8_t or int16_t with MODEL_INT16
+    uint16_t const * indices;   // vertex index of each polyline point, or'ed with MESH_MOVE to begin a polyline
+    uint16_t vertex_count;
+    uint16_t index_count;
+    FLOAT scale;                // model units of one vertex unit
+    uint8_t flags;              // MODEL_INT16
+} model_t;
+
+
+typedef struct vertex_s // transformed mesh vertex cache
+{
+    vector_t v;         // homogeneous clip space
+    int16_t x;          // screen x, when outcode is 0
+    int16_t y;          // screen y, when outcode is 0
+    uint8_t outcode;    // outcode_v() of v
+} vertex_t;
+
+
+typedef struct lines_s  // screen lines of this frame and the last, to find the lines changed
+{
+    int16_t * line[2];  // x0,y0,x1,y1 of each line, for each frame in turn
+    uint16_t count[2];
+    uint16_t capacity;  // lines of each frame
+    uint16_t * table;   // hash table of the lines of both frames, kept from erase_lines() to draw_lines()
+    uint16_t mask;      // table entries - 1, the entries a power of two more than twice capacity
+    uint8_t current;    // line list of this frame
+} lines_t;
+
+
+typedef struct framebuffer_s // 1bpp framebuffer, in pages of 8 rows with the least significant bit on top
+{
+    uint8_t * buffer;   // width * height/8 bytes, page after page, as LCD_DrawFullScreen() expects
+    uint16_t width;
+    uint16_t height;    // a multiple of 8
+    int16_t drawn[4];   // x0,y0,x1,y1 rectangle drawn since the last clear_fb()
+    int16_t dirty[4];   // x0,y0,x1,y1 rectangle changed since the last flush_fb()
+} framebuffer_t;
+
+
+typedef struct node_s   // scene graph node, with cached world and model view projection matrices
+{
+    struct node_s * parent; // parent node, or NULL for the root (usually the camera view)
+    vector_t translation;   // local translation, w is ignored
+    quat_t rotation;        // local rotation, a unit quaternion
+    vector_t scale;         // local scale, w is ignored
+    matrix_t world;         // scale * rotation * translation * parent world
+    matrix_t mvp;           // world * projection
+    uint16_t stamp;         // counts recalculations of world
+    uint16_t parent_stamp;  // parent stamp when world was calculated
+    uint16_t mvp_stamp;     // stamp when mvp was calculated
+    uint8_t dirty;          // set when the local translation, rotation or scale is changed
+} node_t;
+
+
 /****************************************************************************/
 /***        Function Definitions                                          ***/
 /****************************************************************************/
@@ -150,10 +296,18 @@ void scale_v(vector_t * vect,FLOAT scale);
 FLOAT dot_v(vector_t * vect1,vector_t * vect2);
 
 
+/* Produce a cross product between vectors */
+void cross_v(vector_t * product,vector_t const * vect1,vector_t const * vect2);
+
+
 /* Vector Matrix Multiplication */
 void mult_v(vector_t * vect,matrix_t * multiplier);
 
 
+/* Vector Array Matrix Multiplication, out may be the same array as in */
+void mult_va(vector_t * out,vector_t const * in,uint16_t count,matrix_t const * multiplier);
+
+
 /* Produce an identity matrix */
 void identity_m(matrix_t * matrix);
 
@@ -182,6 +336,26 @@ void roty_m(matrix_t * matrix,FLOAT angle);
 void rotz_m(matrix_t * matrix,FLOAT angle);
 
 
+/* Rotation in x dimension, by a binary angle (0x10000 is a full turn) */
+void rotx_bam_m(matrix_t * matrix,uint16_t angle);
+
+
+/* Rotation in y dimension, by a binary angle (0x10000 is a full turn) */
+void roty_bam_m(matrix_t * matrix,uint16_t angle);
+
+
+/* Rotation in z dimension, by a binary angle (0x10000 is a full turn) */
+void rotz_bam_m(matrix_t * matrix,uint16_t angle);
+
+
+/* Rotation in x, then y, then z dimensions */
+void euler_m(matrix_t * matrix,FLOAT x,FLOAT y,FLOAT z);
+
+
+/* Rotation by a unit quaternion */
+void rotq_m(matrix_t * matrix,quat_t const * quat);
+
+
 /* Set up projection OpenGL */
 void projection_opengl_m(matrix_t * matrix,FLOAT fov,FLOAT aspect_ratio,FLOAT near_plane,FLOAT far_plane);
 
@@ -189,10 +363,190 @@ void projection_opengl_m(matrix_t * matrix,FLOAT fov,FLOAT aspect_ratio,FLOAT ne
 /* Set up projection W3Woody */
 void projection_w3woody_m(matrix_t * matrix,FLOAT fov,FLOAT aspect_ratio,FLOAT near_plane,FLOAT far_plane);
 
+
 /* Matrix Multiplication */
 void mult_m(matrix_t * multiplicand,matrix_t * multiplier);
 
 
+/* Matrix Multiplication, into a product distinct from both the multiplicand and multiplier */
+void mult_m_into(matrix_t * product,matrix_t const * multiplicand,matrix_t const * multiplier);
+
+
+/* Affine Matrix Multiplication, where both matrices have a last column of 0,0,0,1 */
+void mult_am(matrix_t * multiplicand,matrix_t const * multiplier);
+
+
+/* Set up a viewport for the screen rectangle at x,y (top left), with y increasing down the screen */
+void viewport_init(viewport_t * viewport,int16_t x,int16_t y,uint16_t width,uint16_t height);
+
+
+/* Project a vector from homogeneous clip space onto the screen, with one reciprocal of w */
+void project_v(vector_t const * vect,viewport_t const * viewport,int16_t * sx,int16_t * sy);
+
+
+/* Produce an identity quaternion */
+void identity_q(quat_t * quat);
+
+
+/* Produce a quaternion rotating by angle about a unit vector axis */
+void axis_q(quat_t * quat,vector_t const * axis,FLOAT angle);
+
+
+/* Produce a quaternion rotating by a binary angle (0x10000 is a full turn) about a unit vector axis */
+void axis_bam_q(quat_t * quat,vector_t const * axis,uint16_t angle);
+
+
+/* Quaternion Multiplication, multiplicand = multiplicand * multiplier */
+void mult_q(quat_t * multiplicand,quat_t const * multiplier);
+
+
+/* Produce a unit quaternion */
+void unit_q(quat_t * quat);
+
+
+/* Rotate a unit quaternion by small angles about its own x, y and z axes, without trigonometry */
+void delta_q(quat_t * quat,FLOAT x,FLOAT y,FLOAT z);
+
+
+/* Outcode of a vector in homogeneous clip space, bits for planes -x +x -y +y -z +z */
+uint8_t outcode_v(vector_t const * vect);
+
+
+/* Clip a line in homogeneous clip space, and produce its screen end points x0,y0,x1,y1 */
+uint8_t clip_line(vector_t const * start,vector_t const * end,viewport_t const * viewport,int16_t * line);
+
+
+/* Produce a bounding sphere centre for the vertices, and return its radius */
+FLOAT bound_sphere(vector_t * centre,vector_t const * vertices,uint16_t count);
+
+
+/* Test whether a sphere in model space is entirely outside the view volume of a model view projection matrix */
+uint8_t cull_sphere(vector_t const * centre,FLOAT radius,matrix_t const * multiplier);
+
+
+/* Produce the eye (view space origin) position in the model space of a model view matrix */
+void eye_m(vector_t * eye,matrix_t const * modelview);
+
+
+/* Set up a mesh from a packed model, expanding its vertices into a caller supplied array of vertex_count */
+void mesh_model(mesh_t * mesh,vector_t * vertices,model_t const * model);
+
+
+/* Transform each unique mesh vertex once into the cache, with its outcode and screen position */
+void mesh_transform(vertex_t * cache,mesh_t const * mesh,matrix_t const * multiplier,viewport_t const * viewport);
+
+
+/* Clip a line between cached vertices, and produce its screen end points x0,y0,x1,y1 */
+uint8_t clip_vertex_line(vertex_t const * start,vertex_t const * end,viewport_t const * viewport,int16_t * line);
+
+
+/* Set up a node with an identity local transform, below parent or as a root when NULL */
+void init_node(node_t * node,node_t * parent);
+
+
+/* Produce the world matrix of a node, recalculating only when it or a parent has changed */
+matrix_t const * world_node(node_t * node);
+
+
+/* Produce the model view projection matrix of a node, recalculating only when its world matrix has changed */
+matrix_t const * mvp_node(node_t * node,matrix_t const * projection);
+
+
+/* Set up a line list for capacity lines a frame, over buffer of 8 * capacity int16_t, and table of a power of two entries more than 2 * capacity */
+void init_lines(lines_t * lines,int16_t * buffer,uint16_t capacity,uint16_t * table,uint16_t entries);
+
+
+/* Add a screen line x0,y0,x1,y1 to this frame, returning 0 if the list is full */
+uint8_t add_lines(lines_t * lines,int16_t const * line);
+
+
+/* Erase the lines of the last frame not in this frame, growing box x0,y0,x1,y1 to cover them */
+void erase_lines(lines_t * lines,void (*erase)(int16_t const * line),int16_t * box);
+
+
+/* Draw the lines of this frame not in the last, redraw kept lines reaching into box x0,y0,x1,y1, and begin the next frame */
+void draw_lines(lines_t * lines,void (*draw)(int16_t const * line),int16_t const * box);
+
+
+/* Erase the lines of the last frame not in this frame, draw the lines of this frame not in the last, and begin the next frame */
+void delta_lines(lines_t * lines,void (*erase)(int16_t const * line),void (*draw)(int16_t const * line));
+
+
+/* Set up a framebuffer over a caller supplied buffer, cleared and all dirty */
+void init_fb(framebuffer_t * fb,uint8_t * buffer,uint16_t width,uint16_t height);
+
+
+/* Clear the rectangle drawn since the last clear, marking it dirty */
+void clear_fb(framebuffer_t * fb);
+
+
+/* Draw a line x0,y0,x1,y1 with Bresenham, ignoring lines not within the framebuffer */
+void line_fb(framebuffer_t * fb,int16_t const * line);
+
+
+/* Write each page of the dirty rectangle to the device, as LCD_WriteSeriesDispRAM() would, and mark it clean */
+void flush_fb(framebuffer_t * fb,void (*write)(uint8_t * buf,uint16_t length,uint8_t x,uint8_t page));
+
+
+/* Sine of a binary angle (0x10000 is a full turn), result Q2.14 (16384 is 1.0) */
+int16_t sin_bam(uint16_t angle);
+
+
+#if defined(__3D_TABLE_TRIG) && !defined(__MATH_FIXED)
+
+/* Floating point sine of an angle in radians, table driven */
+FLOAT sintab(FLOAT angle);
+
+
+/* Floating point cosine of an angle in radians, table driven */
+FLOAT costab(FLOAT angle);
+
+
+/* Floating point tangent of an angle in radians, table driven */
+FLOAT tantab(FLOAT angle);
+
+
+#endif
+
+#ifdef __3D_APU
+
+/* Am9511 APU dot product of count elements, vect2 elements stride apart, keeping the partial sums on the APU stack */
+FLOAT dot_apu(FLOAT const * vect1,FLOAT const * vect2,uint8_t stride,uint8_t count);
+
+
+#endif
+
+#ifdef __MATH_FIXED
+
+/* Q16.16 fixed point multiplication */
+FLOAT mulfix(FLOAT multiplicand,FLOAT multiplier);
+
+
+/* Q16.16 fixed point division, saturating on overflow */
+FLOAT divfix(FLOAT dividend,FLOAT divisor);
+
+
+/* Q16.16 fixed point square root */
+FLOAT sqrtfix(FLOAT x);
+
+
+/* Q16.16 fixed point inverse square root, table driven */
+FLOAT invsqrtfix(FLOAT x);
+
+
+/* Q16.16 fixed point sine of an angle in radians, table driven */
+FLOAT sinfix(FLOAT angle);
+
+
+/* Q16.16 fixed point cosine of an angle in radians, table driven */
+FLOAT cosfix(FLOAT angle);
+
+
+/* Q16.16 fixed point tangent of an angle in radians, table driven */
+FLOAT tanfix(FLOAT angle);
+
+
+#endif
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,102 @@
+/*
+ * invsqrtfix.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+#ifdef __MATH_FIXED
+
+/* Inverse square root table, 48 steps from 1.0 to 4.0 inclusive, Q1.15 */
+static uint16_t const invsqrt_table[49] =
+{
+    32768, 31790, 30894, 30070, 29309, 28602, 27945, 27330,
+    26755, 26214, 25705, 25225, 24770, 24339, 23930, 23541,
+    23170, 22817, 22479, 22155, 21845, 21548, 21263, 20988,
+    20724, 20470, 20225, 19988, 19760, 19539, 19326, 19119,
+    18919, 18725, 18536, 18354, 18176, 18004, 17837, 17674,
+    17515, 17361, 17211, 17064, 16921, 16782, 16646, 16514,
+    16384
+};
+
+/* Q16.16 fixed point inverse square root, table driven */
+FLOAT invsqrtfix(FLOAT x)
+{
+    uint32_t y;
+    uint16_t r;
+    int8_t shift = 1;                           // Q1.15 table to Q16.16 result
+
+    if(x <= 0) return INT32_MAX;
+
+    y = x;
+
+    /* normalise into 1.0 <= y < 4.0, each factor of 4 is a factor of 2 in the result */
+    while(y >= FLOAT_C(4.0)) { y >>= 2; --shift; }
+    while(y < FLOAT_C(1.0)) { y <<= 2; ++shift; }
+
+    y -= FLOAT_C(1.0);
+
+    uint8_t index = (uint8_t)(y >> 12);         // 16 table steps per 1.0
+    uint16_t fraction = (uint16_t)y & 0x0FFF;   // 4096 interpolation steps per table step
+
+    r = invsqrt_table[index];
+    if(fraction)
+    {
+        r -= (uint16_t)(((uint32_t)(r - invsqrt_table[index+1]) * fraction) >> 12);
+    }
+
+    return shift < 0 ? (FLOAT)r >> -shift : (FLOAT)r << shift;
+}
+
+#endif
@@ -0,0 +1,154 @@
+/*
+ * line_fb.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+/*
+ * Bresenham line, always drawn down the framebuffer so that a step in y
+ * is a shift of the pixel mask, and a step down a page is a step of
+ * the pixel pointer by the framebuffer width.
+ */
+
+/* Draw a line x0,y0,x1,y1 with Bresenham, ignoring lines not within the framebuffer */
+void line_fb(framebuffer_t * fb, int16_t const * line)
+{
+    int16_t x0, y0, x1, y1;
+    int16_t dx, dy, err;
+    int8_t step;
+    uint16_t width = fb->width;
+
+    if(line[1] <= line[3])
+    {
+        x0 = line[0]; y0 = line[1];
+        x1 = line[2]; y1 = line[3];
+    }
+    else
+    {
+        x0 = line[2]; y0 = line[3];
+        x1 = line[0]; y1 = line[1];
+    }
+
+    if((uint16_t)x0 >= width || (uint16_t)x1 >= width || y0 < 0 || (uint16_t)y1 >= fb->height) return;
+
+    /* extend the drawn and dirty rectangles once for the whole line */
+    {
+        int16_t left = x0 < x1 ? x0 : x1;
+        int16_t right = x0 < x1 ? x1 : x0;
+        int16_t * rect = fb->drawn;
+
+        for(uint8_t i = 0; i != 2; ++i)
+        {
+            if(left < rect[0]) rect[0] = left;
+            if(y0 < rect[1]) rect[1] = y0;
+            if(right > rect[2]) rect[2] = right;
+            if(y1 > rect[3]) rect[3] = y1;
+            rect = fb->dirty;
+        }
+    }
+
+    uint8_t * p = fb->buffer + (y0 >> 3) * width + x0;
+    uint8_t mask = 1 << (y0 & 7);
+
+    dy = y1 - y0;
+    dx = x1 - x0;
+    step = 1;
+    if(dx < 0)
+    {
+        dx = -dx;
+        step = -1;
+    }
+
+    if(dx >= dy)                                /* x major */
+    {
+        err = dx >> 1;
+        for(int16_t count = dx; count >= 0; --count)
+        {
+            *p |= mask;
+            p += step;
+            err -= dy;
+            if(err < 0)
+            {
+                err += dx;
+                mask <<= 1;
+                if(!mask)
+                {
+                    mask = 1;
+                    p += width;
+                }
+            }
+        }
+    }
+    else                                        /* y major */
+    {
+        err = dy >> 1;
+        for(int16_t count = dy; count >= 0; --count)
+        {
+            *p |= mask;
+            mask <<= 1;
+            if(!mask)
+            {
+                mask = 1;
+                p += width;
+            }
+            err -= dx;
+            if(err < 0)
+            {
+                err += dy;
+                p += step;
+            }
+        }
+    }
+}
@@ -0,0 +1,97 @@
+/*
+ * mesh_transform.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+/* Transform each unique mesh vertex once into the cache, with its outcode and screen position */
+void mesh_transform(vertex_t * cache, mesh_t const * mesh, matrix_t const * multiplier, viewport_t const * viewport)
+{
+    matrix_t m = *multiplier;   // load the matrix once, then address it locally
+
+    vector_t const * in = mesh->vertices;
+    uint16_t count = mesh->vertex_count;
+
+    while(count--)
+    {
+#ifdef __3D_APU
+        /* model vertices have w of 1, so just add the last row */
+        cache->v.x = dot_apu(&in->x, &m.e[0], MATRIX_ORDER, 3) + m.e[12];
+        cache->v.y = dot_apu(&in->x, &m.e[1], MATRIX_ORDER, 3) + m.e[13];
+        cache->v.z = dot_apu(&in->x, &m.e[2], MATRIX_ORDER, 3) + m.e[14];
+        cache->v.w = dot_apu(&in->x, &m.e[3], MATRIX_ORDER, 3) + m.e[15];
+#else
+        FLOAT x = in->x;        // model vertices have w of 1, so just add the last row
+        FLOAT y = in->y;
+        FLOAT z = in->z;
+
+        cache->v.x = MUL(x, m.e[0]) + MUL(y, m.e[4]) + MUL(z, m.e[8 ]) + m.e[12];
+        cache->v.y = MUL(x, m.e[1]) + MUL(y, m.e[5]) + MUL(z, m.e[9 ]) + m.e[13];
+        cache->v.z = MUL(x, m.e[2]) + MUL(y, m.e[6]) + MUL(z, m.e[10]) + m.e[14];
+        cache->v.w = MUL(x, m.e[3]) + MUL(y, m.e[7]) + MUL(z, m.e[11]) + m.e[15];
+#endif
+
+        cache->outcode = outcode_v(&cache->v);
+
+        if(cache->outcode == 0)
+        {
+            project_v(&cache->v, viewport, &cache->x, &cache->y);
+        }
+
+        ++in;
+        ++cache;
+    }
+}
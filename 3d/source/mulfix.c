@@ -0,0 +1,85 @@
+/*
+ * mulfix.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+#ifdef __MATH_FIXED
+
+/* Q16.16 fixed point multiplication */
+FLOAT mulfix(FLOAT multiplicand, FLOAT multiplier)
+{
+    uint32_t a;
+    uint32_t b;
+    uint8_t negative = 0;
+
+    if(multiplicand < 0) { a = -multiplicand; negative = 1; } else { a = multiplicand; }
+    if(multiplier < 0) { b = -multiplier; negative ^= 1; } else { b = multiplier; }
+
+    uint16_t ah = (uint16_t)(a >> 16);
+    uint16_t al = (uint16_t)a;
+    uint16_t bh = (uint16_t)(b >> 16);
+    uint16_t bl = (uint16_t)b;
+
+    /* four 16x16 partial products, only the middle 32 bits of the 64 bit product are kept */
+    a = ((uint32_t)(uint16_t)(ah * bh) << 16)
+        + (uint32_t)ah * bl
+        + (uint32_t)al * bh
+        + (((uint32_t)al * bl) >> 16);
+
+    return negative ? -(FLOAT)a : (FLOAT)a;
+}
+
+#endif
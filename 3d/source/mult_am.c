@@ -0,0 +1,83 @@
+/*
+ * mult_am.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+/* Affine Matrix Multiplication, where both matrices have a last column of 0,0,0,1 */
+void mult_am(matrix_t * multiplicand, matrix_t const * multiplier)
+{
+    FLOAT * e = multiplicand->e;
+    FLOAT const * m = multiplier->e;
+
+    /* the 3x3 linear part, and then the translation row with its implicit w of 1 */
+    for(uint8_t y = 0; y != MATRIX_ORDER; ++y) {
+        FLOAT x0 = e[0];
+        FLOAT x1 = e[1];
+        FLOAT x2 = e[2];
+
+        e[0] = MUL(x0, m[0]) + MUL(x1, m[4]) + MUL(x2, m[8 ]);
+        e[1] = MUL(x0, m[1]) + MUL(x1, m[5]) + MUL(x2, m[9 ]);
+        e[2] = MUL(x0, m[2]) + MUL(x1, m[6]) + MUL(x2, m[10]);
+
+        if(y == MATRIX_ORDER-1) {
+            e[0] += m[12];
+            e[1] += m[13];
+            e[2] += m[14];
+        }
+
+        e += MATRIX_ORDER;
+    }
+}
@@ -43,7 +43,6 @@
 
 #include <stdint.h>
 #include <stdlib.h>
-#include <string.h>
 #include <math.h>
 
 #if __SCCZ80
@@ -63,16 +62,7 @@ void mult_m(matrix_t * multiplicand, matrix_t * multiplier)
 {
     matrix_t result;
 
-    memset(&result, 0, sizeof(FLOAT)*MATRIX_ORDER*MATRIX_ORDER);
-
-    for(uint8_t y = 0; y != MATRIX_ORDER; ++y) {
-        uint8_t col = y * MATRIX_ORDER;
-        for(uint8_t x = 0; x != MATRIX_ORDER; ++x) {
-            for(uint8_t i = 0; i != MATRIX_ORDER; ++i) {
-                result.e[col + x] += multiplicand->e[col + i] * multiplier->e[i * MATRIX_ORDER + x];
-            }
-        }
-    }
+    mult_m_into( &result, multiplicand, multiplier );
 
     *multiplicand = result;
 }
@@ -0,0 +1,81 @@
+/*
+ * mult_m_into.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+/* Matrix Multiplication, into a product distinct from both the multiplicand and multiplier */
+void mult_m_into(matrix_t * product, matrix_t const * multiplicand, matrix_t const * multiplier)
+{
+    FLOAT * p = product->e;
+    FLOAT const * a = multiplicand->e;
+
+    for(uint8_t y = 0; y != MATRIX_ORDER; ++y) {
+        for(uint8_t x = 0; x != MATRIX_ORDER; ++x) {
+#ifdef __3D_APU
+            *p++ = dot_apu(a, &multiplier->e[x], MATRIX_ORDER, MATRIX_ORDER);
+#else
+            FLOAT const * b = &multiplier->e[x];
+            FLOAT sum = MUL(a[0], b[0]);
+            for(uint8_t i = 1; i != MATRIX_ORDER; ++i) {
+                b += MATRIX_ORDER;
+                sum += MUL(a[i], *b);
+            }
+            *p++ = sum;
+#endif
+        }
+        a += MATRIX_ORDER;
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * mult_q.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+/* Quaternion Multiplication, multiplicand = multiplicand * multiplier */
+void mult_q(quat_t * multiplicand, quat_t const * multiplier)
+{
+    FLOAT x = multiplicand->x;
+    FLOAT y = multiplicand->y;
+    FLOAT z = multiplicand->z;
+    FLOAT w = multiplicand->w;
+
+    multiplicand->x = MUL(w, multiplier->x) + MUL(x, multiplier->w) + MUL(y, multiplier->z) - MUL(z, multiplier->y);
+    multiplicand->y = MUL(w, multiplier->y) - MUL(x, multiplier->z) + MUL(y, multiplier->w) + MUL(z, multiplier->x);
+    multiplicand->z = MUL(w, multiplier->z) + MUL(x, multiplier->y) - MUL(y, multiplier->x) + MUL(z, multiplier->w);
+    multiplicand->w = MUL(w, multiplier->w) - MUL(x, multiplier->x) - MUL(y, multiplier->y) - MUL(z, multiplier->z);
+}
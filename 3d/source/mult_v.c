@@ -62,10 +62,18 @@ void mult_v(vector_t * vect, matrix_t * multiplier)
 {
     vector_t result;
 
-    result.x = vect->x*multiplier->e[0] + vect->y*multiplier->e[4] + vect->z*multiplier->e[8 ] + vect->w*multiplier->e[12];
-    result.y = vect->x*multiplier->e[1] + vect->y*multiplier->e[5] + vect->z*multiplier->e[9 ] + vect->w*multiplier->e[13];
-    result.z = vect->x*multiplier->e[2] + vect->y*multiplier->e[6] + vect->z*multiplier->e[10] + vect->w*multiplier->e[14];
-    result.w = vect->x*multiplier->e[3] + vect->y*multiplier->e[7] + vect->z*multiplier->e[11] + vect->w*multiplier->e[15];
+#ifdef __3D_APU
+    result.x = dot_apu(&vect->x, &multiplier->e[0], MATRIX_ORDER, MATRIX_ORDER);
+    result.y = dot_apu(&vect->x, &multiplier->e[1], MATRIX_ORDER, MATRIX_ORDER);
+    result.z = dot_apu(&vect->x, &multiplier->e[2], MATRIX_ORDER, MATRIX_ORDER);
+    result.w = dot_apu(&vect->x, &multiplier->e[3], MATRIX_ORDER, MATRIX_ORDER);
+#else
+
+    result.x = MUL(vect->x, multiplier->e[0]) + MUL(vect->y, multiplier->e[4]) + MUL(vect->z, multiplier->e[8 ]) + MUL(vect->w, multiplier->e[12]);
+    result.y = MUL(vect->x, multiplier->e[1]) + MUL(vect->y, multiplier->e[5]) + MUL(vect->z, multiplier->e[9 ]) + MUL(vect->w, multiplier->e[13]);
+    result.z = MUL(vect->x, multiplier->e[2]) + MUL(vect->y, multiplier->e[6]) + MUL(vect->z, multiplier->e[10]) + MUL(vect->w, multiplier->e[14]);
+    result.w = MUL(vect->x, multiplier->e[3]) + MUL(vect->y, multiplier->e[7]) + MUL(vect->z, multiplier->e[11]) + MUL(vect->w, multiplier->e[15]);
+#endif
 
     *vect = result;
 }
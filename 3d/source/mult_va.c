@@ -0,0 +1,99 @@
+/*
+ * mult_va.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+/* Vector Array Matrix Multiplication */
+void mult_va(vector_t * out, vector_t const * in, uint16_t count, matrix_t const * multiplier)
+{
+    matrix_t m = *multiplier;   // load the matrix once, then address it locally
+
+    while(count--)
+    {
+#ifdef __3D_APU
+        vector_t v = *in;       // load the vertex once, so in place (out == in) works too
+
+        if(v.w == FLOAT_C(1.0)) // the usual w of 1, so just add the last row
+        {
+            out->x = dot_apu(&v.x, &m.e[0], MATRIX_ORDER, 3) + m.e[12];
+            out->y = dot_apu(&v.x, &m.e[1], MATRIX_ORDER, 3) + m.e[13];
+            out->z = dot_apu(&v.x, &m.e[2], MATRIX_ORDER, 3) + m.e[14];
+            out->w = dot_apu(&v.x, &m.e[3], MATRIX_ORDER, 3) + m.e[15];
+        }
+        else
+        {
+            out->x = dot_apu(&v.x, &m.e[0], MATRIX_ORDER, MATRIX_ORDER);
+            out->y = dot_apu(&v.x, &m.e[1], MATRIX_ORDER, MATRIX_ORDER);
+            out->z = dot_apu(&v.x, &m.e[2], MATRIX_ORDER, MATRIX_ORDER);
+            out->w = dot_apu(&v.x, &m.e[3], MATRIX_ORDER, MATRIX_ORDER);
+        }
+#else
+        FLOAT x = in->x;        // load the vertex once, so in place (out == in) works too
+        FLOAT y = in->y;
+        FLOAT z = in->z;
+        FLOAT w = in->w;
+
+        out->x = MUL(x, m.e[0]) + MUL(y, m.e[4]) + MUL(z, m.e[8 ]) + MUL(w, m.e[12]);
+        out->y = MUL(x, m.e[1]) + MUL(y, m.e[5]) + MUL(z, m.e[9 ]) + MUL(w, m.e[13]);
+        out->z = MUL(x, m.e[2]) + MUL(y, m.e[6]) + MUL(z, m.e[10]) + MUL(w, m.e[14]);
+        out->w = MUL(x, m.e[3]) + MUL(y, m.e[7]) + MUL(z, m.e[11]) + MUL(w, m.e[15]);
+#endif
+
+        ++in;
+        ++out;
+    }
+}
@@ -60,14 +60,14 @@
 /* Set up projection OpenGL */
 void projection_opengl_m(matrix_t * matrix, FLOAT fov, FLOAT aspect_ratio, FLOAT near_plane, FLOAT far_plane)
 {
-    FLOAT f = 1.0/TAN(fov * 0.5);
+    FLOAT f = INV(TAN(MUL(fov, FLOAT_C(0.5))));
 
     identity_m( matrix );
 
-    matrix->e[0]  =  f * aspect_ratio;
+    matrix->e[0]  =  MUL(f, aspect_ratio);
     matrix->e[5]  =  f;
-    matrix->e[10] = -(far_plane + near_plane) / (far_plane - near_plane);
-    matrix->e[11] = -1.0;
-    matrix->e[14] = -(far_plane * near_plane * 2.0) / (far_plane - near_plane);
-    matrix->e[15] =  0.0;
+    matrix->e[10] = -DIV(far_plane + near_plane, far_plane - near_plane);
+    matrix->e[11] =  FLOAT_C(-1.0);
+    matrix->e[14] = -DIV(MUL(MUL(far_plane, near_plane), FLOAT_C(2.0)), far_plane - near_plane);
+    matrix->e[15] =  FLOAT_C(0.0);
 }
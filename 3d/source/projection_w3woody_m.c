@@ -65,14 +65,14 @@ void projection_w3woody_m(matrix_t * matrix, FLOAT fov, FLOAT aspect_ratio, FLOA
 {
     (void)far_plane;      // unused here, so avoid compiler warning
 
-    FLOAT f = 1.0/TAN(fov * 0.5);
+    FLOAT f = INV(TAN(MUL(fov, FLOAT_C(0.5))));
 
     identity_m( matrix );
 
-    matrix->e[0]  =  f * aspect_ratio;
+    matrix->e[0]  =  MUL(f, aspect_ratio);
     matrix->e[5]  =  f;
-    matrix->e[10] =  0.0;
-    matrix->e[11] = -1.0;
+    matrix->e[10] =  FLOAT_C(0.0);
+    matrix->e[11] =  FLOAT_C(-1.0);
     matrix->e[14] = -near_plane;
-    matrix->e[15] =  0.0;
+    matrix->e[15] =  FLOAT_C(0.0);
 }
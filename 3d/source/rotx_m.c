@@ -60,17 +60,19 @@
 /* Rotation in x dimension */
 void rotx_m(matrix_t * matrix, FLOAT angle)
 {
-    matrix_t rotx;
+    FLOAT * e = matrix->e;
 
     FLOAT cos_angle = COS(angle);
     FLOAT sin_angle = SIN(angle);
 
-    identity_m( &rotx );
+    /* only the y and z columns are changed */
+    for(uint8_t y = 0; y != MATRIX_ORDER; ++y) {
+        FLOAT e1 = e[1];
+        FLOAT e2 = e[2];
 
-    rotx.e[5]  =  cos_angle;
-    rotx.e[6]  = -sin_angle;
-    rotx.e[9]  =  sin_angle;
-    rotx.e[10] =  cos_angle;
+        e[1] = MUL(e1, cos_angle) + MUL(e2, sin_angle);
+        e[2] = MUL(e2, cos_angle) - MUL(e1, sin_angle);
 
-    mult_m( matrix, &rotx );
+        e += MATRIX_ORDER;
+    }
 }
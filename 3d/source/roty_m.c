@@ -60,17 +60,19 @@
 /* Rotation in y dimension */
 void roty_m(matrix_t * matrix, FLOAT angle)
 {
-    matrix_t roty;
+    FLOAT * e = matrix->e;
 
     FLOAT cos_angle = COS(angle);
     FLOAT sin_angle = SIN(angle);
 
-    identity_m( &roty );
+    /* only the x and z columns are changed */
+    for(uint8_t y = 0; y != MATRIX_ORDER; ++y) {
+        FLOAT e0 = e[0];
+        FLOAT e2 = e[2];
 
-    roty.e[0]  =  cos_angle;
-    roty.e[2]  =  sin_angle;
-    roty.e[8]  = -sin_angle;
-    roty.e[10] =  cos_angle;
+        e[0] = MUL(e0, cos_angle) - MUL(e2, sin_angle);
+        e[2] = MUL(e0, sin_angle) + MUL(e2, cos_angle);
 
-    mult_m( matrix, &roty );
+        e += MATRIX_ORDER;
+    }
 }
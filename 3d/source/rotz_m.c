@@ -60,17 +60,19 @@
 /* Rotation in z dimension */
 void rotz_m(matrix_t * matrix, FLOAT angle)
 {
-    matrix_t rotz;
+    FLOAT * e = matrix->e;
 
     FLOAT cos_angle = COS(angle);
     FLOAT sin_angle = SIN(angle);
 
-    identity_m( &rotz );
+    /* only the x and y columns are changed */
+    for(uint8_t y = 0; y != MATRIX_ORDER; ++y) {
+        FLOAT e0 = e[0];
+        FLOAT e1 = e[1];
 
-    rotz.e[0]  =  cos_angle;
-    rotz.e[1]  = -sin_angle;
-    rotz.e[4]  =  sin_angle;
-    rotz.e[5]  =  cos_angle;
+        e[0] = MUL(e0, cos_angle) + MUL(e1, sin_angle);
+        e[1] = MUL(e1, cos_angle) - MUL(e0, sin_angle);
 
-    mult_m( matrix, &rotz );
+        e += MATRIX_ORDER;
+    }
 }
@@ -59,13 +59,14 @@
 /* Produce a transformation (scale) matrix */
 void scale_m(matrix_t * matrix, FLOAT x, FLOAT y, FLOAT z)
 {
-    matrix_t scale;
+    FLOAT * e = matrix->e;
 
-    identity_m( &scale );
+    /* each of the x, y and z columns is scaled */
+    for(uint8_t i = 0; i != MATRIX_ORDER; ++i) {
+        e[0] = MUL(e[0], x);
+        e[1] = MUL(e[1], y);
+        e[2] = MUL(e[2], z);
 
-    scale.e[0] = x;
-    scale.e[5] = y;
-    scale.e[10] = z;
-
-    mult_m( matrix, &scale );
+        e += MATRIX_ORDER;
+    }
 }
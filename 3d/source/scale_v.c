@@ -59,7 +59,7 @@
 /* Scale a vector, but don't touch w dimension */
 void scale_v(vector_t * vect, FLOAT scale)
 {
-    vect->x *= scale;
-    vect->y *= scale;
-    vect->z *= scale;
+    vect->x = MUL(vect->x, scale);
+    vect->y = MUL(vect->y, scale);
+    vect->z = MUL(vect->z, scale);
 }
@@ -68,12 +68,12 @@ void shear_m(matrix_t * matrix, FLOAT x, FLOAT y, FLOAT z)
 
     identity_m( &shear );
 
-    shear.e[1] = y*invx;
-    shear.e[2] = z*invx;
-    shear.e[4] = x*invy;
-    shear.e[6] = z*invy;
-    shear.e[8] = x*invz;
-    shear.e[9] = y*invz;
+    shear.e[1] = MUL(y, invx);
+    shear.e[2] = MUL(z, invx);
+    shear.e[4] = MUL(x, invy);
+    shear.e[6] = MUL(z, invy);
+    shear.e[8] = MUL(x, invz);
+    shear.e[9] = MUL(y, invz);
 
     mult_m( matrix, &shear );
 }
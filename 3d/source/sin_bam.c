@@ -0,0 +1,115 @@
+/*
+ * sin_bam.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+/* Quarter wave sine table, 256 steps from 0 to pi/2 inclusive, Q2.14 */
+static int16_t const sin_table[257] =
+{
+        0,   101,   201,   302,   402,   503,   603,   704,
+      804,   904,  1005,  1105,  1205,  1306,  1406,  1506,
+     1606,  1706,  1806,  1906,  2006,  2105,  2205,  2305,
+     2404,  2503,  2603,  2702,  2801,  2900,  2999,  3098,
+     3196,  3295,  3393,  3492,  3590,  3688,  3786,  3883,
+     3981,  4078,  4176,  4273,  4370,  4467,  4563,  4660,
+     4756,  4852,  4948,  5044,  5139,  5235,  5330,  5425,
+     5520,  5614,  5708,  5803,  5897,  5990,  6084,  6177,
+     6270,  6363,  6455,  6547,  6639,  6731,  6823,  6914,
+     7005,  7096,  7186,  7276,  7366,  7456,  7545,  7635,
+     7723,  7812,  7900,  7988,  8076,  8163,  8250,  8337,
+     8423,  8509,  8595,  8680,  8765,  8850,  8935,  9019,
+     9102,  9186,  9269,  9352,  9434,  9516,  9598,  9679,
+     9760,  9841,  9921, 10001, 10080, 10159, 10238, 10316,
+    10394, 10471, 10549, 10625, 10702, 10778, 10853, 10928,
+    11003, 11077, 11151, 11224, 11297, 11370, 11442, 11514,
+    11585, 11656, 11727, 11797, 11866, 11935, 12004, 12072,
+    12140, 12207, 12274, 12340, 12406, 12472, 12537, 12601,
+    12665, 12729, 12792, 12854, 12916, 12978, 13039, 13100,
+    13160, 13219, 13279, 13337, 13395, 13453, 13510, 13567,
+    13623, 13678, 13733, 13788, 13842, 13896, 13949, 14001,
+    14053, 14104, 14155, 14206, 14256, 14305, 14354, 14402,
+    14449, 14497, 14543, 14589, 14635, 14680, 14724, 14768,
+    14811, 14854, 14896, 14937, 14978, 15019, 15059, 15098,
+    15137, 15175, 15213, 15250, 15286, 15322, 15357, 15392,
+    15426, 15460, 15493, 15525, 15557, 15588, 15619, 15649,
+    15679, 15707, 15736, 15763, 15791, 15817, 15843, 15868,
+    15893, 15917, 15941, 15964, 15986, 16008, 16029, 16049,
+    16069, 16088, 16107, 16125, 16143, 16160, 16176, 16192,
+    16207, 16221, 16235, 16248, 16261, 16273, 16284, 16295,
+    16305, 16315, 16324, 16332, 16340, 16347, 16353, 16359,
+    16364, 16369, 16373, 16376, 16379, 16381, 16383, 16384,
+    16384
+};
+
+/* Sine of a binary angle (0x10000 is a full turn), result Q2.14 (16384 is 1.0) */
+int16_t sin_bam(uint16_t angle)
+{
+    uint16_t phase = angle & 0x3FFF;            // angle within the quadrant
+    int16_t sine;
+
+    if(angle & 0x4000) phase = 0x4000 - phase;  // second and fourth quadrants mirror
+
+    uint16_t index = phase >> 6;                // 256 table steps per quadrant
+    uint8_t fraction = phase & 0x3F;            // 64 interpolation steps per table step
+
+    sine = sin_table[index];
+    if(fraction)
+    {
+        sine += ((sin_table[index+1] - sine) * fraction) >> 6;
+    }
+
+    return (angle & 0x8000) ? -sine : sine;     // third and fourth quadrants are negative
+}
@@ -59,13 +59,18 @@
 /* Produce a transformation (translation) */
 void translate_m(matrix_t * matrix, FLOAT x, FLOAT y, FLOAT z)
 {
-    matrix_t translation;
+    FLOAT * e = matrix->e;
 
-    identity_m( &translation );
+    /* only rows with a non zero w column are changed, which is just the translation row of an affine matrix */
+    for(uint8_t i = 0; i != MATRIX_ORDER; ++i) {
+        FLOAT w = e[3];
 
-    translation.e[12] = x;
-    translation.e[13] = y;
-    translation.e[14] = z;
+        if(w != 0) {
+            e[0] += MUL(w, x);
+            e[1] += MUL(w, y);
+            e[2] += MUL(w, z);
+        }
 
-    mult_m( matrix, &translation );
+        e += MATRIX_ORDER;
+    }
 }
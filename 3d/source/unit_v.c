@@ -62,8 +62,8 @@ void unit_v(vector_t * vect)
 {
     FLOAT inv_magnitude = INVSQRT( SQR(vect->x) + SQR(vect->y) + SQR(vect->z) );
 
-    vect->x *= inv_magnitude;
-    vect->y *= inv_magnitude;
-    vect->z *= inv_magnitude;
-    vect->w  = 1.0;
+    vect->x = MUL(vect->x, inv_magnitude);
+    vect->y = MUL(vect->y, inv_magnitude);
+    vect->z = MUL(vect->z, inv_magnitude);
+    vect->w = FLOAT_C(1.0);
 }
@@ -0,0 +1,96 @@
+/*
+ * world_node.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * 3D homogeneous coordinate definition
+ * https://en.wikipedia.org/wiki/Homogeneous_coordinates
+ *
+ * project 3D coords onto 2D screen:
+ * https://stackoverflow.com/questions/724219/how-to-convert-a-3d-point-into-2d-perspective-projection
+ *
+ * transformation matrix:
+ * https://www.tutorialspoint.com/computer_graphics/3d_transformation.htm
+ *
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if __SCCZ80
+#include "include/sccz80/3d.h"
+#elif __SDCC
+#include "include/sdcc/3d.h"
+#endif
+
+
+/****************************************************************************/
+/***       Function                                                       ***/
+/****************************************************************************/
+
+
+/*
+ * Each node counts the recalculations of its world matrix in its stamp,
+ * and remembers the stamp of its parent when it was last calculated.
+ * A change anywhere above a node is then found by comparing stamps up
+ * the parent chain, without the parent needing a list of its children.
+ */
+
+/* Produce the world matrix of a node, recalculating only when it or a parent has changed */
+matrix_t const * world_node(node_t * node)
+{
+    node_t * parent = node->parent;
+
+    if(parent)
+    {
+        world_node(parent);
+    }
+
+    if(node->dirty || (parent && node->parent_stamp != parent->stamp))
+    {
+        matrix_t * world = &node->world;
+
+        identity_m(world);
+        scale_m(world, node->scale.x, node->scale.y, node->scale.z);
+        rotq_m(world, &node->rotation);
+        translate_m(world, node->translation.x, node->translation.y, node->translation.z);
+
+        if(parent)
+        {
+            mult_am(world, &parent->world);
+            node->parent_stamp = parent->stamp;
+        }
+
+        ++node->stamp;
+        node->dirty = 0;
+    }
+
+    return &node->world;
+}
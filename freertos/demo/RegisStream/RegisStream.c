@@ -0,0 +1,163 @@
+/*
+ * Example of a ReGIS display fed through a FreeRTOS stream buffer
+ * https://www.freertos.org/RTOS-stream-buffer-example.html
+ *
+ * The draw task calculates each frame, and its ReGIS commands are sent
+ * into a stream buffer rather than written to the serial port. A low
+ * priority transmit task drains the stream buffer to the serial port,
+ * so the draw task only waits for the serial port when the stream buffer
+ * is full, and calculating the next frame overlaps sending the last.
+ */
+
+// needs the regis library built from source for the window sink, as in regis/README.md Preparation
+// zcc +yaz180 -subtype=app -clib=sdcc_iy -SO3 -v -m --list --max-allocs-per-node400000 --math32 -llib/yaz180/freertos -l../../../regis/regis RegisStream.c -o RegisStream -create-app
+// cat > /dev/ttyUSB0 < RegisStream.ihx
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#if __YAZ180
+#include <arch/yaz180.h>
+#endif
+
+/* Scheduler include files. */
+#include <freertos/FreeRTOS.h>
+#include <freertos/timers.h>
+
+// Include stream buffer support
+#include <freertos/stream_buffer.h>
+
+// Include ReGIS library, header matching the library built from source
+#include "../../../regis/source/include/sdcc/regis.h"
+
+#define STREAM_SIZE     1024        // bytes of ReGIS commands waiting to be sent
+#define TRANSMIT_SIZE   32          // bytes sent by the transmit task at a time
+
+#define POINTS          10          // points of the star, inner and outer
+
+/*
+ * Declaring a global variable of type StreamBufferHandle_t
+ *
+ */
+StreamBufferHandle_t regisStream;
+
+window_t regisWindow;
+
+// define two tasks
+void TaskDraw(void *pvParameters);
+void TaskTransmit(void *pvParameters);
+
+
+int main(void) {
+
+    /**
+     * Create a stream buffer.
+     * https://www.freertos.org/xStreamBufferCreate.html
+     */
+    regisStream = xStreamBufferCreate(STREAM_SIZE,  // Stream buffer size
+                                      1             // Trigger level, wake the transmit task for each byte
+                                      );
+
+    if (regisStream != NULL) {
+
+        // Create task that sends the stream buffer to the serial port.
+        xTaskCreate( TaskTransmit, // Task function
+            "Transmit", // A name just for humans
+            128,  // This stack size can be checked & adjusted by reading the Stack Highwater
+            NULL,
+            1, // Priority, with configMAX_PRIORITIES - 1 being the highest, and 0 being the lowest.
+            NULL);
+
+        // Create task that draws the frames into the stream buffer.
+        xTaskCreate( TaskDraw, // Task function
+            "Draw", // Task name
+            256,  // Stack size
+            NULL,
+            2, // Priority
+            NULL);
+    }
+
+    vTaskStartScheduler();
+
+    return 0;
+}
+
+/*
+ * ReGIS sink.
+ * Sends the ReGIS commands into the stream buffer, waiting only while it is full.
+ */
+void regis_sink(char const * data, uint16_t length)
+{
+    while (length)
+    {
+        /**
+         * Send bytes to a stream buffer.
+         * https://www.freertos.org/xStreamBufferSend.html
+         */
+        size_t sent = xStreamBufferSend(regisStream, data, length, portMAX_DELAY);
+        data += sent;
+        length -= sent;
+    }
+}
+
+/*
+ * Draw task.
+ * Calculates a turning star, and draws it into the stream buffer.
+ */
+void TaskDraw(void *pvParameters)
+{
+    (void) pvParameters;
+
+    uint16_t star[2 * (POINTS + 1)];
+    float turn = 0.0;
+
+    for (;;) // A Task shall never return or exit.
+    {
+        for (uint8_t i = 0; i <= POINTS; ++i)
+        {
+            float angle = turn + (float)i * (2.0 * M_PI / POINTS);
+            float radius = (i & 1) ? 80.0 : 200.0;
+
+            star[2 * i] = (uint16_t)(240.0 + radius * cos(angle));
+            star[2 * i + 1] = (uint16_t)(240.0 - radius * sin(angle));
+        }
+
+        window_new(&regisWindow, 480, 480, stdout);
+        window_sink(&regisWindow, regis_sink);     // before any output, so every byte goes through the stream buffer
+        window_clear(&regisWindow);
+
+        draw_intensity(&regisWindow, _Y);
+        draw_abs(&regisWindow, star[0], star[1]);
+        draw_polyline_abs(&regisWindow, &star[2], POINTS);
+
+        window_close(&regisWindow);
+
+        turn += 2.0 * M_PI / 180;
+        if (turn > 2.0 * M_PI) turn -= 2.0 * M_PI;
+    }
+}
+
+/*
+ * Transmit task.
+ * Writes the received bytes from the stream buffer to the serial port.
+ */
+void TaskTransmit(void *pvParameters)
+{
+    (void) pvParameters;
+
+    char buffer[TRANSMIT_SIZE];
+
+    for (;;) // A Task shall never return or exit.
+    {
+        /**
+         * Receive bytes from a stream buffer.
+         * https://www.freertos.org/xStreamBufferReceive.html
+         */
+        size_t received = xStreamBufferReceive(regisStream, buffer, TRANSMIT_SIZE, portMAX_DELAY);
+
+        fwrite(buffer, 1, received, stdout);
+    }
+}
@@ -49,5 +49,26 @@
 /* Set absolute position */
 void draw_abs(window_t * win, uint16_t x, uint16_t y)
 {
-    fprintf(win->fp, "P[%.3d,%.3d]", x, y);
+    char buf[20];
+    char * out = buf;
+
+    if(win->placed && win->x == x && win->y == y)   // already there
+    {
+        ++win->count.elided;
+        return;
+    }
+
+    ++win->count.position;
+    win->placed = 1;
+    win->x = x;
+    win->y = y;
+
+    *out++ = 'P';
+    *out++ = '[';
+    out = regis_uint(out, x, 3);
+    *out++ = ',';
+    out = regis_uint(out, y, 3);
+    *out++ = ']';
+
+    window_write(win, buf, (uint16_t)(out - buf));
 }
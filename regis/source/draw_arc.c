@@ -49,5 +49,17 @@
 /* Draw an arc (circle) in anticlockwise degrees (0 - 360), centred on current position */
 void draw_arc(window_t * win, uint16_t radius, int16_t arc)
 {
-    fprintf(win->fp, "C(A%+.3d)[%+.3d]", arc, radius);
+    char buf[20];
+    char * out = buf;
+
+    memcpy(out, "C(A", 3);
+    out += 3;
+    out = regis_int(out, arc, 3);
+    *out++ = ')';
+    *out++ = '[';
+    out = regis_int(out, radius, 3);
+    *out++ = ']';
+
+    ++win->count.curve;
+    window_write(win, buf, (uint16_t)(out - buf));
 }
@@ -49,5 +49,21 @@
 /* Draw a box from current position */
 void draw_box(window_t * win, int16_t width, int16_t height)
 {
-    fprintf(win->fp, "V(B)[%+.3d,][,%+.3d][%+.3d,](E)", width, height, -width);
+    char buf[36];
+    char * out = buf;
+
+    memcpy(out, "V(B)[", 5);
+    out += 5;
+    out = regis_int(out, width, 3);
+    memcpy(out, ",][,", 4);
+    out += 4;
+    out = regis_int(out, height, 3);
+    *out++ = ']';
+    *out++ = '[';
+    out = regis_int(out, -width, 3);
+    memcpy(out, ",](E)", 5);
+    out += 5;
+
+    ++win->count.vector;
+    window_write(win, buf, (uint16_t)(out - buf));
 }
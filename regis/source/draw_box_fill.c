@@ -49,5 +49,21 @@
 /* Draw a filled box from current position */
 void draw_box_fill(window_t * win, int16_t width, int16_t height)
 {
-    fprintf(win->fp, "V(W(S1))(B)[%+.3d,][,%+.3d][%+.3d,](E)", width, height, -width);
+    char buf[44];
+    char * out = buf;
+
+    memcpy(out, "V(W(S1))(B)[", 12);
+    out += 12;
+    out = regis_int(out, width, 3);
+    memcpy(out, ",][,", 4);
+    out += 4;
+    out = regis_int(out, height, 3);
+    *out++ = ']';
+    *out++ = '[';
+    out = regis_int(out, -width, 3);
+    memcpy(out, ",](E)", 5);
+    out += 5;
+
+    ++win->count.vector;
+    window_write(win, buf, (uint16_t)(out - buf));
 }
@@ -49,5 +49,14 @@
 /* Draw a circle, centred on current position */
 void draw_circle(window_t * win, uint16_t radius)
 {
-    fprintf(win->fp, "C[%+.3d]", radius);
+    char buf[12];
+    char * out = buf;
+
+    *out++ = 'C';
+    *out++ = '[';
+    out = regis_int(out, radius, 3);
+    *out++ = ']';
+
+    ++win->count.curve;
+    window_write(win, buf, (uint16_t)(out - buf));
 }
@@ -49,5 +49,14 @@
 /* Draw a circle filled, centred on current position */
 void draw_circle_fill(window_t * win, uint16_t radius)
 {
-    fprintf(win->fp, "C(W(S1))[%+.3d]", radius);
+    char buf[20];
+    char * out = buf;
+
+    memcpy(out, "C(W(S1))[", 9);
+    out += 9;
+    out = regis_int(out, radius, 3);
+    *out++ = ']';
+
+    ++win->count.curve;
+    window_write(win, buf, (uint16_t)(out - buf));
 }
@@ -49,5 +49,6 @@
 /* Draw custom ReGIS from current position */
 void draw_free(window_t * win, char const * text)
 {
-    fputs((char *)text, win->fp);
+    window_write(win, text, (uint16_t)strlen(text));
+    window_reset(win);          // the custom commands may change any writing state
 }
@@ -49,15 +49,23 @@
 /* Set writing intensity (colour) */
 void draw_intensity(window_t * win, w_intensity_t intensity)
 {
+    if(win->intensity == (uint8_t)intensity)
+    {
+        ++win->count.elided;
+        return;
+    }
+    win->intensity = (uint8_t)intensity;
+    ++win->count.writing;
+
     switch (intensity)
     {
-        case _D: fputs("W(I(D))", win->fp); break;
-        case _B: fputs("W(I(B))", win->fp); break;
-        case _R: fputs("W(I(R))", win->fp); break;
-        case _M: fputs("W(I(M))", win->fp); break;
-        case _G: fputs("W(I(G))", win->fp); break;
-        case _C: fputs("W(I(C))", win->fp); break;
-        case _Y: fputs("W(I(Y))", win->fp); break;
-        case _W: fputs("W(I(W))", win->fp); break;
+        case _D: window_write(win, "W(I(D))", 7); break;
+        case _B: window_write(win, "W(I(B))", 7); break;
+        case _R: window_write(win, "W(I(R))", 7); break;
+        case _M: window_write(win, "W(I(M))", 7); break;
+        case _G: window_write(win, "W(I(G))", 7); break;
+        case _C: window_write(win, "W(I(C))", 7); break;
+        case _Y: window_write(win, "W(I(Y))", 7); break;
+        case _W: window_write(win, "W(I(W))", 7); break;
     }
 }
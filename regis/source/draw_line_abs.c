@@ -49,5 +49,29 @@
 /* Draw a line to absolute location */
 void draw_line_abs(window_t * win, uint16_t x, uint16_t y)
 {
-    fprintf(win->fp, "V[][%.3d,%.3d]", x, y);
+    char buf[28];
+    char * out = buf;
+
+    memcpy(out, "V[]", 3);
+    out += 3;
+
+    if(!win->placed || win->x != x || win->y != y)   // a line to the current position is just a point
+    {
+        *out++ = '[';
+        out = regis_uint(out, x, 3);
+        *out++ = ',';
+        out = regis_uint(out, y, 3);
+        *out++ = ']';
+    }
+    else
+    {
+        ++win->count.elided;
+    }
+
+    ++win->count.vector;
+    win->placed = 1;
+    win->x = x;
+    win->y = y;
+
+    window_write(win, buf, (uint16_t)(out - buf));
 }
@@ -49,5 +49,28 @@
 /* Draw a line to relative position */
 void draw_line_rel(window_t * win, int16_t dx, int16_t dy)
 {
-    fprintf(win->fp, "V[][%+.3d,%+.3d]", dx, dy);
+    char buf[28];
+    char * out = buf;
+
+    memcpy(out, "V[]", 3);
+    out += 3;
+
+    if(dx || dy)                // a line of no length is just a point
+    {
+        *out++ = '[';
+        out = regis_int(out, dx, 3);
+        *out++ = ',';
+        out = regis_int(out, dy, 3);
+        *out++ = ']';
+    }
+    else
+    {
+        ++win->count.elided;
+    }
+
+    ++win->count.vector;
+    win->x += dx;
+    win->y += dy;
+
+    window_write(win, buf, (uint16_t)(out - buf));
 }
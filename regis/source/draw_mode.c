@@ -49,11 +49,19 @@
 /* Set writing mode */
 void draw_mode(window_t * win, w_mode_t mode)
 {
+    if(win->mode == (uint8_t)mode)
+    {
+        ++win->count.elided;
+        return;
+    }
+    win->mode = (uint8_t)mode;
+    ++win->count.writing;
+
     switch (mode)
     {
-        case _REP: fputs("W(R)", win->fp); break;
-        case _ERA: fputs("W(E)", win->fp); break;
-        case _OVL: fputs("W(V)", win->fp); break;
-        case _CPL: fputs("W(C)", win->fp); break;
+        case _REP: window_write(win, "W(R)", 4); break;
+        case _ERA: window_write(win, "W(E)", 4); break;
+        case _OVL: window_write(win, "W(V)", 4); break;
+        case _CPL: window_write(win, "W(C)", 4); break;
     }
 }
@@ -49,5 +49,18 @@
 /* Relative move offset direction */
 void draw_ofs(window_t * win, uint16_t d, offset_t offset)
 {
-    fprintf(win->fp, "P(W(M%d))%d", d, (uint8_t)offset);
+    char buf[20];
+    char * out = buf;
+
+    memcpy(out, "P(W(M", 5);
+    out += 5;
+    out = regis_uint(out, d, 1);
+    *out++ = ')';
+    *out++ = ')';
+    out = regis_uint(out, (uint8_t)offset, 1);
+
+    win->placed = 0;
+
+    ++win->count.position;
+    window_write(win, buf, (uint16_t)(out - buf));
 }
@@ -49,17 +49,25 @@
 /* Set writing pattern */
 void draw_pattern(window_t * win, w_pattern_t pattern)
 {
+    if(win->pattern == (uint8_t)pattern)
+    {
+        ++win->count.elided;
+        return;
+    }
+    win->pattern = (uint8_t)pattern;
+    ++win->count.writing;
+
     switch (pattern)
     {
-        case _P0: fputs("W(P0)", win->fp); break;
-        case _P1: fputs("W(P1)", win->fp); break;
-        case _P2: fputs("W(P2)", win->fp); break;
-        case _P3: fputs("W(P3)", win->fp); break;
-        case _P4: fputs("W(P4)", win->fp); break;
-        case _P5: fputs("W(P5)", win->fp); break;
-        case _P6: fputs("W(P6)", win->fp); break;
-        case _P7: fputs("W(P7)", win->fp); break;
-        case _P8: fputs("W(P8)", win->fp); break;
-        case _P9: fputs("W(P9)", win->fp); break;
+        case _P0: window_write(win, "W(P0)", 5); break;
+        case _P1: window_write(win, "W(P1)", 5); break;
+        case _P2: window_write(win, "W(P2)", 5); break;
+        case _P3: window_write(win, "W(P3)", 5); break;
+        case _P4: window_write(win, "W(P4)", 5); break;
+        case _P5: window_write(win, "W(P5)", 5); break;
+        case _P6: window_write(win, "W(P6)", 5); break;
+        case _P7: window_write(win, "W(P7)", 5); break;
+        case _P8: window_write(win, "W(P8)", 5); break;
+        case _P9: window_write(win, "W(P9)", 5); break;
     }
 }
@@ -49,5 +49,7 @@
 /* Draw a pixel at absolute location */
 void draw_pixel_abs(window_t * win, uint16_t x, uint16_t y)
 {
-    fprintf(win->fp, "P[%.3d,%.3d]V[]", x, y);
+    draw_abs(win, x, y);
+    ++win->count.vector;
+    window_write(win, "V[]", 3);
 }
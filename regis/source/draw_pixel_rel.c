@@ -49,5 +49,6 @@
 /* Draw a pixel to screen at current position */
 void draw_pixel_rel(window_t * win)
 {
-    fputs("V[]", win->fp);
+    ++win->count.vector;
+    window_write(win, "V[]", 3);
 }
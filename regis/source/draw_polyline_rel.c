@@ -0,0 +1,100 @@
+/*
+ * draw_polyline_rel.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#if __SCCZ80
+#include "include/sccz80/regis.h"
+#elif __SDCC
+#include "include/sdcc/regis.h"
+#endif
+
+
+/****************************************************************************/
+/***       Functions                                                      ***/
+/****************************************************************************/
+
+/*
+ * One vector command draws the whole run of offsets. Offsets are not
+ * padded, and a zero offset is omitted, so [,+dy] moves vertically and
+ * [+dx] horizontally.
+ */
+
+/* Draw lines from current position through n relative offsets, of dx dy pairs */
+void draw_polyline_rel(window_t * win, int16_t const * dxy, uint16_t n)
+{
+    char buf[16];
+
+    if(n == 0) return;      // V[] alone would draw a point at the current position
+
+    ++win->count.vector;
+    window_write(win, "V[]", 3);
+
+    for(uint16_t i = 0; i < n; ++i, dxy += 2)
+    {
+        char * out = buf;
+
+        if(!dxy[0] && !dxy[1])
+        {
+            ++win->count.elided;
+            continue;
+        }
+
+        *out++ = '[';
+        if(dxy[0])
+        {
+            out = regis_int(out, dxy[0], 1);
+        }
+        else
+        {
+            ++win->count.elided;
+        }
+        if(dxy[1])
+        {
+            *out++ = ',';
+            out = regis_int(out, dxy[1], 1);
+        }
+        else
+        {
+            ++win->count.elided;
+        }
+        *out++ = ']';
+
+        win->x += dxy[0];
+        win->y += dxy[1];
+
+        window_write(win, buf, (uint16_t)(out - buf));
+    }
+}
@@ -49,5 +49,25 @@
 /* Relative move position */
 void draw_rel(window_t * win, int16_t dx, int16_t dy)
 {
-    fprintf(win->fp, "P[%+.3d,%+.3d]", dx, dy);
+    char buf[20];
+    char * out = buf;
+
+    if(!dx && !dy)
+    {
+        ++win->count.elided;
+        return;
+    }
+
+    ++win->count.position;
+    win->x += dx;
+    win->y += dy;
+
+    *out++ = 'P';
+    *out++ = '[';
+    out = regis_int(out, dx, 3);
+    *out++ = ',';
+    out = regis_int(out, dy, 3);
+    *out++ = ']';
+
+    window_write(win, buf, (uint16_t)(out - buf));
 }
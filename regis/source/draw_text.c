@@ -49,7 +49,13 @@
 /* Draw text from current position */
 void draw_text(window_t * win, char const * text, uint8_t size)
 {
-    fprintf(win->fp, "T(S%.2d)\"", size);
-    fputs((char *)text, win->fp);
-    fputs((char *)"\"", win->fp);
+    size_t length = strlen(text);
+
+    do {
+        uint8_t len = length > UINT8_MAX ? UINT8_MAX : (uint8_t)length;
+
+        draw_text_n(win, text, len, size);
+        text += len;
+        length -= len;
+    } while(length);
 }
@@ -0,0 +1,96 @@
+/*
+ * draw_text_n.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#if __SCCZ80
+#include "include/sccz80/regis.h"
+#elif __SDCC
+#include "include/sdcc/regis.h"
+#endif
+
+
+/****************************************************************************/
+/***       Functions                                                      ***/
+/****************************************************************************/
+
+/*
+ * The text is copied in one pass, doubling any quote so that it is drawn
+ * rather than ending the string, and the size is only sent when changed.
+ */
+
+/* Draw len characters of text from current position */
+void draw_text_n(window_t * win, char const * text, uint8_t len, uint8_t size)
+{
+    char buf[32];
+    char * out = buf;
+
+    ++win->count.text;
+
+    *out++ = 'T';
+    if(win->text_size != size)
+    {
+        win->text_size = size;
+        *out++ = '(';
+        *out++ = 'S';
+        out = regis_uint(out, size, 2);
+        *out++ = ')';
+    }
+    else
+    {
+        ++win->count.elided;
+    }
+    *out++ = '"';
+
+    while(len--)
+    {
+        if(out > buf + sizeof(buf) - 3)
+        {
+            window_write(win, buf, (uint16_t)(out - buf));
+            out = buf;
+        }
+
+        if(*text == '"')
+        {
+            *out++ = '"';
+        }
+        *out++ = *text++;
+    }
+    *out++ = '"';
+
+    window_write(win, buf, (uint16_t)(out - buf));
+
+    win->placed = 0;            // the text moves the current position
+}
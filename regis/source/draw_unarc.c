@@ -49,5 +49,17 @@
 /* Erase an arc (circle) in anticlockwise degrees (0 - 360), centred on current position */
 void draw_unarc(window_t * win, uint16_t radius, int16_t arc)
 {
-    fprintf(win->fp, "C(W(E))(A%+.3d)[%+.3d]", arc, radius);
+    char buf[28];
+    char * out = buf;
+
+    memcpy(out, "C(W(E))(A", 9);
+    out += 9;
+    out = regis_int(out, arc, 3);
+    *out++ = ')';
+    *out++ = '[';
+    out = regis_int(out, radius, 3);
+    *out++ = ']';
+
+    ++win->count.curve;
+    window_write(win, buf, (uint16_t)(out - buf));
 }
@@ -49,5 +49,14 @@
 /* Erase a circle, centred on current position */
 void draw_uncircle(window_t * win, uint16_t radius)
 {
-    fprintf(win->fp, "C(W(E))[%+.3d]", radius);
+    char buf[16];
+    char * out = buf;
+
+    memcpy(out, "C(W(E))[", 8);
+    out += 8;
+    out = regis_int(out, radius, 3);
+    *out++ = ']';
+
+    ++win->count.curve;
+    window_write(win, buf, (uint16_t)(out - buf));
 }
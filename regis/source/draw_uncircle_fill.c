@@ -49,5 +49,14 @@
 /* Erase a circle filled, centred on current position */
 void draw_uncircle_fill(window_t * win, uint16_t radius)
 {
-    fprintf(win->fp, "C(W(S1,E))[%+.3d]", radius);
+    char buf[20];
+    char * out = buf;
+
+    memcpy(out, "C(W(S1,E))[", 11);
+    out += 11;
+    out = regis_int(out, radius, 3);
+    *out++ = ']';
+
+    ++win->count.curve;
+    window_write(win, buf, (uint16_t)(out - buf));
 }
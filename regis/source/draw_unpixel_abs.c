@@ -49,5 +49,7 @@
 /* Erase a pixel at absolute location */
 void draw_unpixel_abs(window_t * win, uint16_t x, uint16_t y)
 {
-    fprintf(win->fp, "P[%.3d,%.3d]V(W(E))[]", x, y);
+    draw_abs(win, x, y);
+    ++win->count.vector;
+    window_write(win, "V(W(E))[]", 9);
 }
@@ -49,5 +49,6 @@
 /* Erase a pixel at current position */
 void draw_unpixel_rel(window_t * win)
 {
-    fputs("V(W(E))[]", win->fp);
+    ++win->count.vector;
+    window_write(win, "V(W(E))[]", 9);
 }
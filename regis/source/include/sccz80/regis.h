@@ -65,6 +65,8 @@ extern "C" {
 #define WIDTH_MAX       768         // maximum width  (ReGIS maximum 768)
 #define HEIGHT_MAX      480         // desired height (ReGIS maximum 480)
 
+#define W_UNKNOWN       0xFF        // writing state not known, so it is sent
+
 
 
 /* offset direction */
@@ -117,6 +119,18 @@ typedef enum w_intensity_e
     _W   = 7            // White
 } w_intensity_t;
 
+/* Output counted since the window was opened, or the counts were read */
+
+typedef struct window_count_s {
+    uint32_t bytes;     // bytes written
+    uint16_t position;  // P position commands
+    uint16_t vector;    // V vector commands
+    uint16_t curve;     // C curve commands
+    uint16_t text;      // T text commands
+    uint16_t writing;   // W writing commands
+    uint16_t elided;    // redundant commands, or parts of commands, not sent
+} window_count_t;
+
 /* Structure to use when opening a window - as per usual,if type <> 0
  * then open graphics window number with width (in pixels) width.
  */
@@ -126,6 +140,25 @@ typedef struct window_s {
 
     uint16_t width;     // desired window width  (ReGIS maximum 768)
     uint16_t height;    // desired window height (ReGIS maximum 480)
+
+    char * buffer;      // optional output buffer, or NULL to write directly
+    uint16_t size;      // size of the output buffer
+    uint16_t used;      // bytes waiting in the output buffer
+    void (*sink)(char const * data,uint16_t length);    // optional output function, used in place of fp
+    uint8_t entered;    // graphics mode entered, with the first output
+
+    uint8_t intensity;  // writing intensity last sent, or W_UNKNOWN
+    uint8_t mode;       // writing mode last sent, or W_UNKNOWN
+    uint8_t pattern;    // writing pattern last sent, or W_UNKNOWN
+    uint8_t text_size;  // text size last sent, or W_UNKNOWN
+    uint8_t placed;     // current position x,y is known
+    uint16_t x;         // current position
+    uint16_t y;
+
+    uint32_t macros;    // macrographs defined, bit 0 for @A to bit 25 for @Z
+    char macro;         // macrograph being defined, or 0 when none
+
+    window_count_t count;   // output counts
 } window_t;
 
 /****************************************************************************/
@@ -146,6 +179,46 @@ void __LIB__ window_close(window_t * win) __smallc;
 
 
 
+/* Buffer the output of a window, in size bytes of buffer, or write directly when NULL */
+void __LIB__ window_buffer(window_t * win,char * buffer,uint16_t size) __smallc;
+
+
+
+/* Send the output of a window to a sink function, or to its FILE when NULL */
+void __LIB__ window_sink(window_t * win,void (*sink)(char const * data,uint16_t length)) __smallc;
+
+
+
+/* Write length bytes of data to the window, through its buffer when provided */
+void __LIB__ window_write(window_t * win,char const * data,uint16_t length) __smallc;
+
+
+
+/* Write out any buffered output of the window */
+void __LIB__ window_flush(window_t * win) __smallc;
+
+
+
+/* Forget the writing state and position, so that the next commands are sent in full */
+void __LIB__ window_reset(window_t * win) __smallc;
+
+
+
+/* Read the output counts into count, unless NULL, and restart them */
+void __LIB__ window_count(window_t * win,window_count_t * count) __smallc;
+
+
+
+/* Encode value in ASCII, with at least digits digits, and return the end of the text */
+char * __LIB__ regis_uint(char * text,uint16_t value,uint8_t digits) __smallc;
+
+
+
+/* Encode value in ASCII with its sign, with at least digits digits, and return the end of the text */
+char * __LIB__ regis_int(char * text,int16_t value,uint8_t digits) __smallc;
+
+
+
 /* Set writing mode */
 void __LIB__ draw_mode(window_t * win,w_mode_t mode) __smallc;
 
@@ -216,6 +289,16 @@ void __LIB__ draw_unline_abs(window_t * win,uint16_t x,uint16_t y) __smallc;
 
 
 
+/* Draw lines from current position through n relative offsets, of dx dy pairs */
+void __LIB__ draw_polyline_rel(window_t * win,int16_t const * dxy,uint16_t n) __smallc;
+
+
+
+/* Draw lines from current position through n absolute locations, of xy pairs */
+void __LIB__ draw_polyline_abs(window_t * win,uint16_t const * xy,uint16_t n) __smallc;
+
+
+
 /* Draw a box from current position */
 void __LIB__ draw_box(window_t * win,int16_t width,int16_t height) __smallc;
 
@@ -271,11 +354,36 @@ void __LIB__ draw_text(window_t * win,char const * text,uint8_t size) __smallc;
 
 
 
+/* Draw len characters of text from current position */
+void __LIB__ draw_text_n(window_t * win,char const * text,uint8_t len,uint8_t size) __smallc;
+
+
+
 /* Draw custom ReGIS from current position */
 void __LIB__ draw_free(window_t * win,char const * text) __smallc;
 
 
 
+/* Clear all macrographs */
+void __LIB__ macro_clear(window_t * win) __smallc;
+
+
+
+/* Begin defining macrograph id 'A' to 'Z', returning 0 for an invalid id */
+uint8_t __LIB__ macro_begin(window_t * win,char id) __smallc;
+
+
+
+/* End defining the macrograph */
+void __LIB__ macro_end(window_t * win) __smallc;
+
+
+
+/* Invoke macrograph id, returning 0 when it is not defined */
+uint8_t __LIB__ macro_invoke(window_t * win,char id) __smallc;
+
+
+
 #ifdef __cplusplus
 }
 #endif
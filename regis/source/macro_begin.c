@@ -0,0 +1,70 @@
+/*
+ * macro_begin.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#if __SCCZ80
+#include "include/sccz80/regis.h"
+#elif __SDCC
+#include "include/sdcc/regis.h"
+#endif
+
+
+/****************************************************************************/
+/***       Functions                                                      ***/
+/****************************************************************************/
+
+/*
+ * The commands of a macrograph are stored by the terminal, not executed,
+ * and the writing state when it is invoked is not known. So the writing
+ * state is forgotten, and each macrograph sends its own state in full.
+ */
+
+/* Begin defining macrograph id 'A' to 'Z', returning 0 for an invalid id */
+uint8_t macro_begin(window_t * win, char id)
+{
+    char buf[3];
+
+    if(id < 'A' || id > 'Z') return 0;
+
+    buf[0] = '@';
+    buf[1] = ':';
+    buf[2] = id;
+
+    window_write(win, buf, 3);
+    window_reset(win);
+    win->macro = id;
+    return 1;
+}
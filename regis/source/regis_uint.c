@@ -0,0 +1,84 @@
+/*
+ * regis_uint.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#if __SCCZ80
+#include "include/sccz80/regis.h"
+#elif __SDCC
+#include "include/sdcc/regis.h"
+#endif
+
+
+/****************************************************************************/
+/***       Functions                                                      ***/
+/****************************************************************************/
+
+/*
+ * The digits are found by subtracting powers of ten, so that neither the
+ * printf engine nor a division by ten is needed for each coordinate.
+ */
+
+static uint16_t const power[5] = { 10000, 1000, 100, 10, 1 };
+
+/* Encode value in ASCII, with at least digits digits, and return the end of the text */
+char * regis_uint(char * text, uint16_t value, uint8_t digits)
+{
+    uint8_t i;
+    uint8_t lead = 1;           // skipping leading zeros
+
+    for(i = 0; i != 5; ++i)
+    {
+        char digit = '0';
+
+        while(value >= power[i])
+        {
+            value -= power[i];
+            ++digit;
+        }
+
+        if(digit != '0' || i >= 5 - digits)
+        {
+            lead = 0;
+        }
+
+        if(!lead)
+        {
+            *text++ = digit;
+        }
+    }
+
+    return text;
+}
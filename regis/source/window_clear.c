@@ -49,5 +49,6 @@
 /* Clear window */
 void window_clear(window_t * win)
 {
-    fputs("S(E)", win->fp);
+    window_write(win, "S(E)", 4);
+    window_reset(win);
 }
@@ -46,9 +46,21 @@
 /***       Functions                                                      ***/
 /****************************************************************************/
 
+/*
+ * The window may be drawn into again after it is closed, and graphics
+ * mode is then entered again with its next output. The macrographs it
+ * has defined are still tracked, so a window opened once by window_new()
+ * can be reused frame after frame.
+ */
+
 /* Close a graphics window, return to text mode */
 void window_close(window_t * win)
 {
-    fprintf(win->fp, "%c%c\n", ASCII_ESC, ASCII_BSLASH);
+    static char const leave[3] = { ASCII_ESC, ASCII_BSLASH, ASCII_LF };
+
+    window_write(win, leave, 3);
+    window_flush(win);
+    window_reset(win);
+    win->entered = 0;
 }
 
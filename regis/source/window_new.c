@@ -54,7 +54,15 @@ uint8_t window_new(window_t * win, uint16_t width, uint16_t height, FILE * fp)
         if (fp != NULL) win->fp = fp; else return 0;
         if (width && width < WIDTH_MAX) win->width = width; else win->width = WIDTH_MAX-1;
         if (height && height < HEIGHT_MAX) win->height = height; else win->height = HEIGHT_MAX-1;
-        fprintf(win->fp, "%cP1p", ASCII_ESC);
+        win->buffer = NULL;
+        win->size = 0;
+        win->used = 0;
+        win->sink = NULL;
+        win->entered = 0;
+        win->macros = 0;
+        win->macro = 0;
+        window_reset(win);
+        memset(&win->count, 0, sizeof(window_count_t));
         return 1;
     }
     else
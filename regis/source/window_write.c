@@ -0,0 +1,85 @@
+/*
+ * window_write.c
+ *
+ * Copyright (c) 2026 Phillip Stevens
+ * Create Time: October 2026
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted,free of charge,to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),to deal
+ * in the Software without restriction,including without limitation the rights
+ * to use,copy,modify,merge,publish,distribute,sublicense,and/or sell
+ * copies of the Software,and to permit persons to whom the Software is
+ * furnished to do so,subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS",WITHOUT WARRANTY OF ANY KIND,EXPRESS OR
+ * IMPLIED,INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,DAMAGES OR OTHER
+ * LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE,ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/****************************************************************************/
+/***        Include files                                                 ***/
+/****************************************************************************/
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#if __SCCZ80
+#include "include/sccz80/regis.h"
+#elif __SDCC
+#include "include/sdcc/regis.h"
+#endif
+
+
+/****************************************************************************/
+/***       Functions                                                      ***/
+/****************************************************************************/
+
+/* Write length bytes of data to the window, through its buffer when provided */
+void window_write(window_t * win, char const * data, uint16_t length)
+{
+    static char const enter[4] = { ASCII_ESC, 'P', '1', 'p' };
+
+    if(!win->entered)           // enter graphics mode with the first output, so it goes through any sink
+    {
+        win->entered = 1;
+        window_write(win, enter, 4);
+    }
+
+    win->count.bytes += length;
+
+    if(win->buffer != NULL)
+    {
+        if(length > win->size - win->used)
+        {
+            window_flush(win);
+        }
+
+        if(length <= win->size)
+        {
+            memcpy(win->buffer + win->used, data, length);
+            win->used += length;
+            return;
+        }
+    }
+
+    if(win->sink != NULL)
+    {
+        win->sink(data, length);
+    }
+    else
+    {
+        fwrite(data, 1, length, win->fp);
+    }
+}